@@ -0,0 +1,158 @@
+/*
+  Layer compositor for cLEDMatrix
+
+  Each layer is a full cLEDMatrix of the same type as the output, so the drawing,
+  Shift and LEDText functions all work on a layer unchanged. Composite() only
+  rebuilds the area that the layers have marked dirty since the last call.
+*/
+
+#ifndef LEDLayers_h
+#define LEDLayers_h
+
+#include <LEDMatrix.h>
+
+#define LEDLAYERS_MAX   4
+
+enum LayerBlend_t
+{
+  LAYER_OPAQUE,     // Replaces everything below it, black included
+  LAYER_MASK,       // Black pixels are transparent, others replace what is below
+  LAYER_ALPHA,      // Black pixels are transparent, others are blended with the layer alpha
+  LAYER_ADD         // Added to what is below, saturating
+};
+
+template <class tMatrix>
+class cLEDLayers
+{
+private:
+  tMatrix *m_Out;
+  tMatrix *m_Layer[LEDLAYERS_MAX];
+  uint8_t m_Blend[LEDLAYERS_MAX];
+  uint8_t m_Alpha[LEDLAYERS_MAX];
+  bool m_Visible[LEDLAYERS_MAX];
+  uint8_t m_Layers;
+  bool m_Full;                  // Layer order/visibility/blend changed, recomposite everything
+
+public:
+  cLEDLayers(tMatrix *pOut)
+  {
+    m_Out = pOut;
+    m_Layers = 0;
+    m_Full = true;
+  }
+
+  // Layers are composited in the order they are added, the first one is the bottom
+  int8_t AddLayer(tMatrix *pLayer, LayerBlend_t Blend = LAYER_MASK, uint8_t Alpha = 255)
+  {
+    if (m_Layers >= LEDLAYERS_MAX)
+      return (-1);
+    m_Layer[m_Layers] = pLayer;
+    m_Blend[m_Layers] = Blend;
+    m_Alpha[m_Layers] = Alpha;
+    m_Visible[m_Layers] = true;
+    m_Full = true;
+    return (m_Layers++);
+  }
+  tMatrix *Layer(uint8_t Layer)
+  {
+    return ((Layer < m_Layers) ? m_Layer[Layer] : NULL);
+  }
+  uint8_t Layers() { return (m_Layers); }
+
+  void SetVisible(uint8_t Layer, bool Visible)
+  {
+    if ((Layer < m_Layers) && (m_Visible[Layer] != Visible))
+    {
+      m_Visible[Layer] = Visible;
+      m_Full = true;
+    }
+  }
+  bool Visible(uint8_t Layer) { return ((Layer < m_Layers) && (m_Visible[Layer])); }
+  void SetBlend(uint8_t Layer, LayerBlend_t Blend, uint8_t Alpha = 255)
+  {
+    if (Layer < m_Layers)
+    {
+      m_Blend[Layer] = Blend;
+      m_Alpha[Layer] = Alpha;
+      m_Full = true;
+    }
+  }
+
+  // Rebuilds the output where any layer changed, returns false if nothing did
+  bool Composite()
+  {
+    int16_t x0, y0, x1, y1;
+    int16_t lx0, ly0, lx1, ly1;
+    uint8_t l;
+
+    if (m_Full)
+    {
+      x0 = y0 = 0;
+      x1 = m_Out->Width() - 1;
+      y1 = m_Out->Height() - 1;
+    }
+    else
+    {
+      x0 = m_Out->Width();
+      y0 = m_Out->Height();
+      x1 = y1 = -1;
+    }
+    for (l = 0; l < m_Layers; ++l)
+    {
+      // Hidden layers can change freely, they are picked up in full when shown again
+      if ((m_Visible[l]) && (m_Layer[l]->DirtyRect(lx0, ly0, lx1, ly1)))
+      {
+        x0 = min(x0, lx0);
+        y0 = min(y0, ly0);
+        x1 = max(x1, lx1);
+        y1 = max(y1, ly1);
+      }
+      m_Layer[l]->ClearDirty();
+    }
+    m_Full = false;
+    if ((x0 > x1) || (y0 > y1))
+      return (false);
+    for (int16_t y = y0; y <= y1; ++y)
+    {
+      for (int16_t x = x0; x <= x1; ++x)
+      {
+        struct CRGB Col = CRGB(0, 0, 0);
+        for (l = 0; l < m_Layers; ++l)
+        {
+          if (!m_Visible[l])
+            continue;
+          const struct CRGB &Src = (*m_Layer[l])(x, y);
+          switch (m_Blend[l])
+          {
+          case LAYER_OPAQUE:
+            Col = Src;
+            break;
+          case LAYER_MASK:
+            if (Src)
+              Col = Src;
+            break;
+          case LAYER_ALPHA:
+            if (Src)
+              nblend(Col, Src, m_Alpha[l]);
+            break;
+          case LAYER_ADD:
+            Col += Src;
+            break;
+          }
+        }
+        (*m_Out)(x, y) = Col;
+      }
+    }
+    m_Out->MarkDirty(x0, y0, x1, y1);
+    return (true);
+  }
+
+  // Composite() then the output matrix Show(), which skips the frame if nothing changed
+  bool Show()
+  {
+    Composite();
+    return (m_Out->Show());
+  }
+};
+
+#endif
@@ -16,6 +16,194 @@ struct CRGB m_OutOfBounds;
 
 cLEDMatrixBase::cLEDMatrixBase()
 {
+  m_Out = NULL;
+  m_XOrigin = m_YOrigin = 0;
+  m_RowMajor = false;
+  // Size is not known yet, DirtyRect() clips this to the whole matrix
+  m_DirtyX0 = m_DirtyY0 = 0;
+  m_DirtyX1 = m_DirtyY1 = 0x7fff;
+  m_Changes = 0;
+  m_FramesSent = m_FramesSkipped = 0;
+  for (uint8_t i=0; i<8; ++i)
+  {
+    m_MirrorTable[i] = NULL;
+    m_MirrorWords[i] = 0;
+  }
+  m_MirrorUntabled = 0;
+  m_MirrorRec = NULL;
+  m_LUT = NULL;
+  m_Dither = false;
+  m_DitherStep = 0;
+  m_DitherMicros = m_ShowMicros = 0;
+  m_OutputMicros = 0;
+  m_Controller = NULL;
+}
+
+void cLEDMatrixBase::SetOutputArray(struct CRGB *pOut, bool RowMajor)
+{
+  bool WasRowMajor = m_RowMajor;
+
+  if ( (m_Out) && ((m_XOrigin != 0) || (m_YOrigin != 0) || (m_RowMajor)) )
+  {
+    // Put the pixels back where the direct mode expects them, without the output LUT
+    uint16_t *pLUT = m_LUT;
+    m_LUT = NULL;
+    RenderOutput();
+    m_LUT = pLUT;
+    memcpy(m_LED, m_Out, Size() * sizeof(struct CRGB));
+  }
+  m_XOrigin = m_YOrigin = 0;
+  m_RowMajor = false;
+  RowMajor = (RowMajor && pOut);
+  // Mirror tables hold indexes of the old order
+  if (RowMajor != WasRowMajor)
+    FreeMirrorTables();
+  if (RowMajor)
+  {
+    int16_t x, y;
+    // pOut is free until the next RenderOutput(), use it to reorder the pixels
+    memcpy(pOut, m_LED, Size() * sizeof(struct CRGB));
+    for (y=0; y<m_Height; ++y)
+    {
+      for (x=0; x<m_Width; ++x)
+        m_LED[(y * m_Width) + x] = pOut[mXY(x, y)];
+    }
+    m_RowMajor = true;
+  }
+  m_Out = pOut;
+  MarkDirty();
+}
+
+void cLEDMatrixBase::MarkDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  if (x0 > x1)
+  {
+    int16_t t = x0;
+    x0 = x1;
+    x1 = t;
+  }
+  if (y0 > y1)
+  {
+    int16_t t = y0;
+    y0 = y1;
+    y1 = t;
+  }
+  if ((x1 < 0) || (y1 < 0) || (x0 >= m_Width) || (y0 >= m_Height))
+    return;
+  x0 = max(x0, (int16_t)0);
+  y0 = max(y0, (int16_t)0);
+  x1 = min(x1, (int16_t)(m_Width - 1));
+  y1 = min(y1, (int16_t)(m_Height - 1));
+  if (m_DirtyX0 > m_DirtyX1)
+  {
+    m_DirtyX0 = x0;
+    m_DirtyY0 = y0;
+    m_DirtyX1 = x1;
+    m_DirtyY1 = y1;
+  }
+  else
+  {
+    m_DirtyX0 = min(m_DirtyX0, x0);
+    m_DirtyY0 = min(m_DirtyY0, y0);
+    m_DirtyX1 = max(m_DirtyX1, x1);
+    m_DirtyY1 = max(m_DirtyY1, y1);
+  }
+  m_Changes++;
+}
+
+bool cLEDMatrixBase::DirtyRect(int16_t &x0, int16_t &y0, int16_t &x1, int16_t &y1)
+{
+  if (m_DirtyX0 > m_DirtyX1)
+    return(false);
+  x0 = m_DirtyX0;
+  y0 = m_DirtyY0;
+  x1 = min(m_DirtyX1, (int16_t)(m_Width - 1));
+  y1 = min(m_DirtyY1, (int16_t)(m_Height - 1));
+  return(true);
+}
+
+bool cLEDMatrixBase::Show()
+{
+  uint32_t t = micros();
+
+  // An unchanged frame is only resent to step the LUT dither, and no more often than its interval
+  if ( (m_DirtyX0 > m_DirtyX1) && ((!(m_Dither && m_LUT && m_Out)) || ((t - m_ShowMicros) < m_DitherMicros)) )
+  {
+    m_FramesSkipped++;
+    return(false);
+  }
+  m_ShowMicros = t;
+  RenderOutput();
+  m_OutputMicros = micros() - t;
+  ClearDirty();
+  FastLED.show();
+  m_FramesSent++;
+  return(true);
+}
+
+void cLEDMatrixBase::SetOutputLUT(uint8_t Brightness, const struct CRGB &Correction, float Gamma, bool Dither, uint16_t DitherMillis)
+{
+  if (!m_LUT)
+    m_LUT = (uint16_t *)malloc(3 * 256 * sizeof(uint16_t));
+  if (!m_LUT)
+    return;
+  for (uint8_t c=0; c<3; ++c)
+  {
+    // 65280 is 255.0 in 8.8 fixed point
+    float Scale = 65280.0f * (Brightness / 255.0f) * (Correction.raw[c] / 255.0f);
+    for (uint16_t i=0; i<256; ++i)
+      m_LUT[(c * 256) + i] = (uint16_t)((pow(i / 255.0f, Gamma) * Scale) + 0.5f);
+  }
+  m_Dither = Dither;
+  m_DitherMicros = (uint32_t)DitherMillis * 1000;
+  MarkDirty();
+}
+
+void cLEDMatrixBase::ClearOutputLUT()
+{
+  free(m_LUT);
+  m_LUT = NULL;
+  MarkDirty();
+}
+
+void cLEDMatrixBase::ApplyOutputLUT(const struct CRGB *pSrc)
+{
+  // Rounding, or with dithering a threshold that moves every frame so the fraction averages out
+  static const uint8_t DitherSteps[8] = { 0x10, 0x90, 0x50, 0xd0, 0x30, 0xb0, 0x70, 0xf0 };
+  const uint16_t *pR = m_LUT, *pG = &m_LUT[256], *pB = &m_LUT[512];
+  uint16_t d = m_Dither ? DitherSteps[m_DitherStep++ & 7] : 0x80;
+  struct CRGB *pDst = m_Out;
+
+  for (int i=Size(); i>0; --i,++pSrc,++pDst)
+  {
+    pDst->r = (pR[pSrc->r] + d) >> 8;
+    pDst->g = (pG[pSrc->g] + d) >> 8;
+    pDst->b = (pB[pSrc->b] + d) >> 8;
+  }
+}
+
+void cLEDMatrixBase::LendController(struct CRGB *pLeds, int Leds)
+{
+  if (m_Controller)
+    m_Controller->setLeds(pLeds, Leds);
+}
+
+void cLEDMatrixBase::ReclaimController()
+{
+  if (m_Controller)
+  {
+    m_Controller->setLeds(OutputArray(), Size());
+    MarkDirty();
+  }
+}
+
+uint32_t cLEDMatrixBase::ShowBytes()
+{
+  uint32_t Bytes = 0;
+
+  for (int i=0; i<FastLED.count(); ++i)
+    Bytes += FastLED[i].size() * 3;
+  return(Bytes);
 }
 
 struct CRGB* cLEDMatrixBase::operator[](int n)
@@ -39,10 +227,256 @@ struct CRGB& cLEDMatrixBase::operator()(int16_t i)
     return(m_OutOfBounds);
 }
 
+// Mirror copies are recorded as runs of
+//   Len, Src, SStep, Fan, then Fan times Dst, DStep
+// where each step reads Src once and writes it to Fan destinations, in the same order as the mirror loops.
+// A copy that doesn't continue a run is stored as 0, Dst, Src.
+struct cMirrorRec
+{
+  uint16_t *Buf;
+  uint16_t Words, Alloc;
+  bool Failed;
+  // Run being extended
+  uint16_t Len, Src, Dst[3];
+  int16_t SStep, DStep[3];
+  uint8_t Fan;
+  // Copies sharing one source
+  uint16_t StepSrc, StepDst[3];
+  uint8_t StepFan;
+};
+
+static uint16_t *MirrorAlloc(struct cMirrorRec *r, uint16_t n)
+{
+  if ((uint32_t)r->Words + n > r->Alloc)
+  {
+    uint32_t a = max((uint32_t)64, (uint32_t)r->Alloc * 2);
+    uint16_t *b = NULL;
+    if (a > 0xffff)
+      a = 0xffff;
+    if ((uint32_t)r->Words + n <= a)
+      b = (uint16_t *)realloc(r->Buf, a * sizeof(uint16_t));
+    if (!b)
+    {
+      r->Failed = true;
+      return(NULL);
+    }
+    r->Buf = b;
+    r->Alloc = a;
+  }
+  r->Words += n;
+  return(&r->Buf[r->Words - n]);
+}
+
+static void MirrorEmitRun(struct cMirrorRec *r)
+{
+  uint16_t *p;
+  uint8_t k;
+
+  if ( (r->Len == 0) || (r->Failed) )
+    return;
+  if (r->Len == 1)
+  {
+    for (k=0; (k<r->Fan) && (p = MirrorAlloc(r, 3)); ++k)
+    {
+      p[0] = 0;
+      p[1] = r->Dst[k];
+      p[2] = r->Src;
+    }
+  }
+  else if ((p = MirrorAlloc(r, 4 + (r->Fan * 2))))
+  {
+    *p++ = r->Len;
+    *p++ = r->Src;
+    *p++ = (uint16_t)r->SStep;
+    *p++ = r->Fan;
+    for (k=0; k<r->Fan; ++k)
+    {
+      *p++ = r->Dst[k];
+      *p++ = (uint16_t)r->DStep[k];
+    }
+  }
+}
+
+static void MirrorEndStep(struct cMirrorRec *r)
+{
+  uint8_t k;
+
+  if (r->StepFan == 0)
+    return;
+  if ( (r->Len > 0) && (r->Fan == r->StepFan) )
+  {
+    if (r->Len == 1)
+    {
+      // Second step fixes the strides of the run
+      int32_t d = (int32_t)r->StepSrc - r->Src;
+      for (k=0; (k<r->Fan) && (d >= -32768) && (d <= 32767); ++k)
+      {
+        r->DStep[k] = (int16_t)((int32_t)r->StepDst[k] - r->Dst[k]);
+        if ((int32_t)r->DStep[k] != ((int32_t)r->StepDst[k] - r->Dst[k]))
+          break;
+      }
+      if (k == r->Fan)
+      {
+        r->SStep = (int16_t)d;
+        r->Len++;
+        r->StepFan = 0;
+        return;
+      }
+    }
+    else if ( (r->Len < 0xffff) && ((int32_t)r->StepSrc == (int32_t)r->Src + ((int32_t)r->Len * r->SStep)) )
+    {
+      for (k=0; k<r->Fan; ++k)
+      {
+        if ((int32_t)r->StepDst[k] != (int32_t)r->Dst[k] + ((int32_t)r->Len * r->DStep[k]))
+          break;
+      }
+      if (k == r->Fan)
+      {
+        r->Len++;
+        r->StepFan = 0;
+        return;
+      }
+    }
+  }
+  MirrorEmitRun(r);
+  r->Len = 1;
+  r->Src = r->StepSrc;
+  r->SStep = 0;
+  r->Fan = r->StepFan;
+  for (k=0; k<r->Fan; ++k)
+  {
+    r->Dst[k] = r->StepDst[k];
+    r->DStep[k] = 0;
+  }
+  r->StepFan = 0;
+}
+
+bool cLEDMatrixBase::MirrorBegin(uint8_t Mode)
+{
+  MarkDirty();
+  // Tables hold layout indices, in viewport mode with a moved origin mXY() is used instead
+  if ( (m_XOrigin != 0) || (m_YOrigin != 0) || (m_MirrorUntabled & (1 << Mode)) )
+    return(false);
+  if (m_MirrorTable[Mode])
+  {
+    MirrorApply(m_MirrorTable[Mode], m_MirrorWords[Mode]);
+    return(true);
+  }
+  m_MirrorRec = (struct cMirrorRec *)calloc(1, sizeof(struct cMirrorRec));
+  return(false);
+}
+
+void cLEDMatrixBase::MirrorRecord(uint16_t Dst, uint16_t Src)
+{
+  struct cMirrorRec *r = m_MirrorRec;
+
+  if ( (r->StepFan == 0) || (r->StepSrc != Src) || (r->StepFan == 3) )
+  {
+    MirrorEndStep(r);
+    r->StepSrc = Src;
+  }
+  r->StepDst[r->StepFan++] = Dst;
+}
+
+void cLEDMatrixBase::MirrorEnd(uint8_t Mode)
+{
+  struct cMirrorRec *r = m_MirrorRec;
+
+  if (!r)
+    return;
+  m_MirrorRec = NULL;
+  MirrorEndStep(r);
+  MirrorEmitRun(r);
+  // Out of memory, don't try again for this mirror
+  if ( (r->Failed) || (r->Words == 0) )
+  {
+    free(r->Buf);
+    m_MirrorUntabled |= (1 << Mode);
+  }
+  else
+  {
+    m_MirrorTable[Mode] = (uint16_t *)realloc(r->Buf, r->Words * sizeof(uint16_t));
+    if (!m_MirrorTable[Mode])
+      m_MirrorTable[Mode] = r->Buf;
+    m_MirrorWords[Mode] = r->Words;
+  }
+  free(r);
+}
+
+void cLEDMatrixBase::MirrorApply(const uint16_t *pRun, uint16_t Words)
+{
+  const uint16_t *pEnd = pRun + Words;
+
+  while (pRun < pEnd)
+  {
+    if (pRun[0] == 0)
+    {
+      m_LED[pRun[1]] = m_LED[pRun[2]];
+      pRun += 3;
+      continue;
+    }
+    uint16_t Len = pRun[0];
+    int32_t Src = pRun[1];
+    int16_t SStep = (int16_t)pRun[2];
+    uint8_t Fan = pRun[3];
+    const uint16_t *pDst = &pRun[4];
+    pRun += 4 + (Fan * 2);
+    if ( (Fan == 1) && ((int16_t)pDst[1] == SStep) && ((SStep == 1) || (SStep == -1)) && (abs((int32_t)pDst[0] - Src) >= Len) )
+    {
+      // Contiguous and not overlapping, copy order doesn't matter
+      int32_t Dst = pDst[0];
+      if (SStep < 0)
+      {
+        Src -= Len - 1;
+        Dst -= Len - 1;
+      }
+      memcpy(&m_LED[Dst], &m_LED[Src], Len * sizeof(struct CRGB));
+    }
+    else if (Fan == 1)
+    {
+      int32_t Dst = pDst[0];
+      int16_t DStep = (int16_t)pDst[1];
+      for (; Len>0; --Len,Src+=SStep,Dst+=DStep)
+        m_LED[Dst] = m_LED[Src];
+    }
+    else
+    {
+      int32_t Dst[3];
+      uint8_t k;
+      for (k=0; k<Fan; ++k)
+        Dst[k] = pDst[k * 2];
+      for (; Len>0; --Len,Src+=SStep)
+      {
+        struct CRGB Col = m_LED[Src];
+        for (k=0; k<Fan; ++k)
+        {
+          m_LED[Dst[k]] = Col;
+          Dst[k] += (int16_t)pDst[(k * 2) + 1];
+        }
+      }
+    }
+  }
+}
+
+void cLEDMatrixBase::FreeMirrorTables()
+{
+  for (uint8_t i=0; i<8; ++i)
+  {
+    free(m_MirrorTable[i]);
+    m_MirrorTable[i] = NULL;
+    m_MirrorWords[i] = 0;
+  }
+  m_MirrorUntabled = 0;
+}
+
+
 void cLEDMatrixBase::HorizontalMirror(bool FullHeight)
 {
   int ty, y, x, xx;
+  uint8_t Mode = (FullHeight ? MIRROR_HFULL : MIRROR_HHALF);
 
+  if (MirrorBegin(Mode))
+    return;
   if (FullHeight)
     ty = m_Height - 1;
   else
@@ -50,8 +484,9 @@ void cLEDMatrixBase::HorizontalMirror(bool FullHeight)
   for (y=ty; y>=0; --y)
   {
     for (x=(m_Width/2)-1,xx=((m_Width+1)/2); x>=0; --x,++xx)
-      m_LED[mXY(xx, y)] = m_LED[mXY(x, y)];
+      MirrorCopy(mXY(xx, y), mXY(x, y));
   }
+  MirrorEnd(Mode);
 }
 
 
@@ -59,11 +494,14 @@ void cLEDMatrixBase::VerticalMirror()
 {
   int y, yy, x;
 
+  if (MirrorBegin(MIRROR_V))
+    return;
   for (y=(m_Height/2)-1,yy=((m_Height+1)/2); y>=0; --y,++yy)
   {
     for (x=m_Width-1; x>=0; --x)
-      m_LED[mXY(x, yy)] = m_LED[mXY(x, y)];
+      MirrorCopy(mXY(x, yy), mXY(x, y));
   }
+  MirrorEnd(MIRROR_V);
 }
 
 
@@ -78,6 +516,8 @@ void cLEDMatrixBase::QuadrantRotateMirror()
 {
   int MaxXY, MidXY, x, y, src;
 
+  if (MirrorBegin(MIRROR_QROTATE))
+    return;
   if (m_Width > m_Height)
     MaxXY = m_Height;
   else
@@ -89,18 +529,22 @@ void cLEDMatrixBase::QuadrantRotateMirror()
     for (y=MidXY-(MaxXY%2); y>=0; --y)
     {
       src = mXY(x, y);
-      m_LED[mXY(MidXY + y, MidXY - (MaxXY % 2) - x)] = m_LED[src];
-      m_LED[mXY(MaxXY - x, MaxXY - y)] = m_LED[src];
-      m_LED[mXY(MidXY - (MaxXY % 2) - y, MidXY + x)] = m_LED[src];
+      MirrorCopy(mXY(MidXY + y, MidXY - (MaxXY % 2) - x), src);
+      MirrorCopy(mXY(MaxXY - x, MaxXY - y), src);
+      MirrorCopy(mXY(MidXY - (MaxXY % 2) - y, MidXY + x), src);
     }
   }
+  MirrorEnd(MIRROR_QROTATE);
 }
 
 
 void cLEDMatrixBase::TriangleTopMirror(bool FullHeight)
 {
   int MaxXY, x, y;
+  uint8_t Mode = (FullHeight ? MIRROR_TTOPFULL : MIRROR_TTOPHALF);
 
+  if (MirrorBegin(Mode))
+    return;
   if (m_Width > m_Height)
     MaxXY = m_Height - 1;
   else
@@ -110,15 +554,19 @@ void cLEDMatrixBase::TriangleTopMirror(bool FullHeight)
   for (y=1; y<=MaxXY; ++y)
   {
     for (x=0; x<y; ++x)
-      m_LED[mXY(y,x)] = m_LED[mXY(x,y)];
+      MirrorCopy(mXY(y,x), mXY(x,y));
   }
+  MirrorEnd(Mode);
 }
 
 
 void cLEDMatrixBase::TriangleBottomMirror(bool FullHeight)
 {
   int MaxXY, x, y, xx, yy;
+  uint8_t Mode = (FullHeight ? MIRROR_TBOTFULL : MIRROR_TBOTHALF);
 
+  if (MirrorBegin(Mode))
+    return;
   if (m_Width > m_Height)
     MaxXY = m_Height - 1;
   else
@@ -128,8 +576,9 @@ void cLEDMatrixBase::TriangleBottomMirror(bool FullHeight)
   for (y=0,xx=MaxXY; y<MaxXY; y++,xx--)
   {
     for (x=MaxXY-y-1,yy=y+1; x>=0; --x,++yy)
-      m_LED[mXY(xx, yy)] = m_LED[mXY(x, y)];
+      MirrorCopy(mXY(xx, yy), mXY(x, y));
   }
+  MirrorEnd(Mode);
 }
 
 
@@ -146,12 +595,59 @@ void cLEDMatrixBase::QuadrantBottomTriangleMirror()
   QuadrantMirror();
 }
 
+void cLEDMatrixBase::DrawHSpan(int16_t x0, int16_t x1, int16_t y, CRGB Col)
+{
+  if (x0 > x1)
+  {
+    int16_t t = x0;
+    x0 = x1;
+    x1 = t;
+  }
+  if ((y < 0) || (y >= m_Height) || (x1 < 0) || (x0 >= m_Width))
+    return;
+  x0 = max(x0, (int16_t)0);
+  x1 = min(x1, (int16_t)(m_Width - 1));
+  MarkDirty(x0, y, x1, y);
+  FillSpan(true, x0, x1, y, Col);
+}
+
+void cLEDMatrixBase::DrawVSpan(int16_t x, int16_t y0, int16_t y1, CRGB Col)
+{
+  if (y0 > y1)
+  {
+    int16_t t = y0;
+    y0 = y1;
+    y1 = t;
+  }
+  if ((x < 0) || (x >= m_Width) || (y1 < 0) || (y0 >= m_Height))
+    return;
+  y0 = max(y0, (int16_t)0);
+  y1 = min(y1, (int16_t)(m_Height - 1));
+  MarkDirty(x, y0, x, y1);
+  FillSpan(false, y0, y1, x, Col);
+}
+
 void cLEDMatrixBase::DrawPixel(int16_t x, int16_t y, CRGB Col) {
-  DrawLine(x, y, x, y, Col);
+  if ((x >= 0) && (x < m_Width) && (y >= 0) && (y < m_Height))
+  {
+    m_LED[mXY(x, y)] = Col;
+    MarkDirty(x, y, x, y);
+  }
 }
 
 void cLEDMatrixBase::DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col)
 {
+  if (y0 == y1)
+  {
+    DrawHSpan(x0, x1, y0, Col);
+    return;
+  }
+  if (x0 == x1)
+  {
+    DrawVSpan(x0, y0, y1, Col);
+    return;
+  }
+  MarkDirty(x0, y0, x1, y1);
   int16_t dx = x1 - x0;
   int16_t dy = y1 - y0;
   if (abs(dx) >= abs(dy))
@@ -203,6 +699,7 @@ void cLEDMatrixBase::DrawRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y
 
 void cLEDMatrixBase::DrawCircle(int16_t xc, int16_t yc, uint16_t r, CRGB Col)
 {
+  MarkDirty(xc - r, yc - r, xc + r, yc + r);
   int16_t x = -r;
   int16_t y = 0;
   int16_t e = 2 - (2 * r);
@@ -224,9 +721,24 @@ void cLEDMatrixBase::DrawCircle(int16_t xc, int16_t yc, uint16_t r, CRGB Col)
 
 void cLEDMatrixBase::DrawFilledRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col)
 {
-  int16_t y = min(y0, y1);
-  for (int16_t c=abs(y1-y0); c>=0; --c,++y)
-    DrawLine(x0, y, x1, y, Col);
+  // Clip once, then fill along whichever direction the layout keeps contiguous
+  int16_t xl = max(min(x0, x1), (int16_t)0);
+  int16_t xr = min(max(x0, x1), (int16_t)(m_Width - 1));
+  int16_t yt = max(min(y0, y1), (int16_t)0);
+  int16_t yb = min(max(y0, y1), (int16_t)(m_Height - 1));
+  if ((xl > xr) || (yt > yb))
+    return;
+  MarkDirty(xl, yt, xr, yb);
+  if (m_VerticalRuns)
+  {
+    for (int16_t x=xl; x<=xr; ++x)
+      FillSpan(false, yt, yb, x, Col);
+  }
+  else
+  {
+    for (int16_t y=yt; y<=yb; ++y)
+      FillSpan(true, xl, xr, y, Col);
+  }
 }
 
 
@@ -237,10 +749,10 @@ void cLEDMatrixBase::DrawFilledCircle(int16_t xc, int16_t yc, uint16_t r, CRGB C
   int16_t e = 1 - x;
   while (x >= y)
   {
-    DrawLine(xc + x, yc + y, xc - x, yc + y, Col);
-    DrawLine(xc + y, yc + x, xc - y, yc + x, Col);
-    DrawLine(xc - x, yc - y, xc + x, yc - y, Col);
-    DrawLine(xc - y, yc - x, xc + y, yc - x, Col);
+    DrawHSpan(xc - x, xc + x, yc + y, Col);
+    DrawHSpan(xc - y, xc + y, yc + x, Col);
+    DrawHSpan(xc - x, xc + x, yc - y, Col);
+    DrawHSpan(xc - y, xc + y, yc - x, Col);
     ++y;
     if (e >= 0)
     {
@@ -23,6 +23,8 @@ enum BlockType_t
   VERTICAL_ZIGZAG_BLOCKS
 };
 
+extern struct CRGB m_OutOfBounds;
+
 class cLEDMatrixBase
 {
   friend class cSprite;
@@ -31,12 +33,60 @@ protected:
   int16_t m_Width, m_Height;
   struct CRGB *m_LED;
   //struct CRGB m_OutOfBounds;
+  struct CRGB *m_Out;             // Output array handed to FastLED, NULL when drawing straight into it
+  int16_t m_XOrigin, m_YOrigin;   // Viewport origin, only moves while an output array is set
+  bool m_RowMajor;                // Drawing array is in logical y * Width + x order, RenderOutput() remaps it
+  int16_t m_DirtyX0, m_DirtyY0, m_DirtyX1, m_DirtyY1;   // Changed area since the last Show(), empty when X0 > X1
+  bool m_VerticalRuns;            // Columns rather than rows are the contiguous runs of the layout
+  uint16_t m_Changes;
+  uint32_t m_FramesSent, m_FramesSkipped;
+  // Copy runs recorded by the first call of each mirror, see MirrorBegin()
+  uint16_t *m_MirrorTable[8];
+  uint16_t m_MirrorWords[8];
+  uint8_t m_MirrorUntabled;       // Bit per mirror whose table could not be allocated, these keep using mXY()
+  struct cMirrorRec *m_MirrorRec;
+  uint16_t *m_LUT;                // Output LUT, 3 x 256 entries in 8.8 fixed point, NULL when not used
+  bool m_Dither;
+  uint8_t m_DitherStep;
+  uint32_t m_DitherMicros, m_ShowMicros;   // Least time between frames resent only for the dither, last Show()
+  uint32_t m_OutputMicros;
+  CLEDController *m_Controller;
 
 public:
   cLEDMatrixBase();
   virtual uint32_t mXY(uint16_t x, uint16_t y) = 0;
   void SetLEDArray(struct CRGB *pLED); // Only used with externally defined LED arrays
 
+  // Viewport mode, Shift functions then only move the origin and RenderOutput() builds the frame in pOut.
+  // RowMajor also keeps the drawing array in logical row order, the chain layout is only applied by RenderOutput().
+  void SetOutputArray(struct CRGB *pOut, bool RowMajor = false);
+  struct CRGB *OutputArray() { return (m_Out ? m_Out : m_LED); }
+  virtual void RenderOutput() = 0;
+  int16_t XOrigin() { return (m_XOrigin); }
+  int16_t YOrigin() { return (m_YOrigin); }
+  bool RowMajor() { return (m_RowMajor); }
+
+  // Dirty area tracking, drawing/shift/mirror functions and cLEDText mark what they change.
+  // Direct writes through operator() are not tracked, call MarkDirty() after them.
+  void MarkDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+  void MarkDirty() { MarkDirty(0, 0, m_Width - 1, m_Height - 1); }
+  void ClearDirty() { m_DirtyX0 = 1; m_DirtyX1 = 0; }
+  bool IsDirty() { return (m_DirtyX0 <= m_DirtyX1); }
+  bool DirtyRect(int16_t &x0, int16_t &y0, int16_t &x1, int16_t &y1);
+  uint16_t ChangeCount() { return (m_Changes); }   // Increments with every MarkDirty() that hits the matrix
+  // Renders the output and calls FastLED.show() only if something changed since the last call
+  bool Show();
+  uint32_t FramesSent() { return (m_FramesSent); }
+  uint32_t FramesSkipped() { return (m_FramesSkipped); }
+
+  // Gamma, colour correction and brightness folded into one table that RenderOutput() applies while
+  // building the output array, so it needs SetOutputArray() and FastLED left at brightness 255 and
+  // UncorrectedColor. With Dither the fraction is spread over frames and Show() also resends unchanged
+  // frames to step it, at most every DitherMillis.
+  void SetOutputLUT(uint8_t Brightness, const struct CRGB &Correction = CRGB(255, 255, 255), float Gamma = 1.0, bool Dither = false, uint16_t DitherMillis = 0);
+  void ClearOutputLUT();
+  uint32_t OutputMicros() { return (m_OutputMicros); }   // RenderOutput() time of the last Show()
+
   struct CRGB *operator[](int n);
   struct CRGB &operator()(int16_t x, int16_t y);
   struct CRGB &operator()(int16_t i);
@@ -45,6 +95,24 @@ public:
   int Width() { return (m_Width); }
   int Height() { return (m_Height); }
 
+  // Equal slices of the output array for controllers that are clocked out at the same time,
+  // Segments should divide the number of tiles so every slice is made of whole tiles
+  struct CRGB *Segment(uint8_t Seg, uint8_t Segments) { return (&OutputArray()[(Size() / Segments) * Seg]); }
+  int SegmentSize(uint8_t Segments) { return (Size() / Segments); }
+  // The FastLED controller of the output array. Effects with their own buffer borrow it with
+  // LendController() rather than adding controllers, every added one is clocked out on each show().
+  CLEDController &SetController(CLEDController &Controller) { m_Controller = &Controller; return (Controller); }
+  CLEDController *Controller() { return (m_Controller); }
+  void LendController(struct CRGB *pLeds, int Leds);
+  void ReclaimController();
+  // Bytes all registered FastLED controllers send per show(), 3 per LED (per lane for block controllers)
+  static uint32_t ShowBytes();
+  // Time to clock out Leds split over Segments parallel outputs, 24 bits per LED plus the latch (WS2812B defaults)
+  static uint32_t ShowMicros(uint32_t Leds, uint8_t Segments = 1, uint16_t BitNanos = 1250, uint16_t LatchMicros = 280)
+  {
+    return (((((Leds + Segments - 1) / Segments) * 24 * BitNanos) / 1000) + LatchMicros);
+  }
+
   void HorizontalMirror(bool FullHeight = true);
   void VerticalMirror();
   void QuadrantMirror();
@@ -53,6 +121,11 @@ public:
   void TriangleBottomMirror(bool FullHeight = true);
   void QuadrantTopTriangleMirror();
   void QuadrantBottomTriangleMirror();
+  void FreeMirrorTables();        // Releases the run tables, they are rebuilt on next use
+
+  // Clipped once, then written as runs of pixels by the layout aware FillSpan()
+  void DrawHSpan(int16_t x0, int16_t x1, int16_t y, CRGB Col);
+  void DrawVSpan(int16_t x, int16_t y0, int16_t y1, CRGB Col);
 
   void DrawPixel(int16_t x, int16_t y, CRGB Col);
   void DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col);
@@ -60,6 +133,23 @@ public:
   void DrawCircle(int16_t xc, int16_t yc, uint16_t r, CRGB Col);
   void DrawFilledRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, CRGB Col);
   void DrawFilledCircle(int16_t xc, int16_t yc, uint16_t r, CRGB Col);
+
+protected:
+  void ApplyOutputLUT(const struct CRGB *pSrc);
+  enum { MIRROR_HFULL, MIRROR_HHALF, MIRROR_V, MIRROR_QROTATE, MIRROR_TTOPFULL, MIRROR_TTOPHALF, MIRROR_TBOTFULL, MIRROR_TBOTHALF };
+  bool MirrorBegin(uint8_t Mode);
+  void MirrorCopy(uint16_t Dst, uint16_t Src)
+  {
+    m_LED[Dst] = m_LED[Src];
+    if (m_MirrorRec)
+      MirrorRecord(Dst, Src);
+  }
+  void MirrorRecord(uint16_t Dst, uint16_t Src);
+  void MirrorEnd(uint8_t Mode);
+  void MirrorApply(const uint16_t *pRun, uint16_t Words);
+
+  // Span that is already clipped, along x (a0..a1 at y = c) or along y (a0..a1 at x = c)
+  virtual void FillSpan(bool AlongX, int16_t a0, int16_t a1, int16_t c, CRGB Col) = 0;
 };
 
 template <int16_t tMWidth, int16_t tMHeight, MatrixType_t tMType, int8_t tBWidth = 1, int8_t tBHeight = 1, BlockType_t tBType = HORIZONTAL_BLOCKS>
@@ -72,11 +162,27 @@ private:
   static const int16_t m_absBHeight = (tBHeight * ((tBHeight < 0) * -1 + (tBHeight > 0)));
   struct CRGB *p_LED;
 
+  // Compile time x/y to index table, only instantiated when mXYTable() is used
+  struct cXYTable
+  {
+    uint16_t Index[m_absMWidth * m_absBWidth * m_absMHeight * m_absBHeight];
+    constexpr cXYTable() : Index()
+    {
+      for (uint16_t y = 0; y < (m_absMHeight * m_absBHeight); ++y)
+      {
+        for (uint16_t x = 0; x < (m_absMWidth * m_absBWidth); ++x)
+          Index[(y * (m_absMWidth * m_absBWidth)) + x] = mXYCalc(x, y);
+      }
+    }
+  };
+  static const cXYTable m_XYTable;
+
 public:
   cLEDMatrix(bool doMalloc = true)
   {
     m_Width = m_absMWidth * m_absBWidth;
     m_Height = m_absMHeight * m_absBHeight;
+    m_VerticalRuns = ((tMType == VERTICAL_MATRIX) || (tMType == VERTICAL_ZIGZAG_MATRIX));
     if (doMalloc)
     {
       // On ESP32, there is more memory available via malloc than static global arrays
@@ -99,8 +205,110 @@ public:
   {
     p_LED = pLED;
     m_LED = pLED;
+    MarkDirty();
   }
   virtual uint32_t mXY(uint16_t x, uint16_t y)
+  {
+    return (mXYDirect(x, y));
+  }
+
+  // Non virtual mapping, can be inlined where the concrete matrix type is known
+  inline uint32_t mXYDirect(uint16_t x, uint16_t y)
+  {
+    if (m_XOrigin)
+    {
+      x += m_XOrigin;
+      if (x >= (m_absMWidth * m_absBWidth))
+        x -= (m_absMWidth * m_absBWidth);
+    }
+    if (m_YOrigin)
+    {
+      y += m_YOrigin;
+      if (y >= (m_absMHeight * m_absBHeight))
+        y -= (m_absMHeight * m_absBHeight);
+    }
+    if (m_RowMajor)
+      return ((y * (m_absMWidth * m_absBWidth)) + x);
+    return (mXYLayout(x, y));
+  }
+
+  // Physical position in the LED chain, ignoring the viewport origin
+  static inline uint32_t mXYLayout(uint16_t x, uint16_t y)
+  {
+#ifdef LEDMATRIX_XY_TABLE
+    return (mXYTable(x, y));
+#else
+    return (mXYCalc(x, y));
+#endif
+  }
+
+  virtual void RenderOutput()
+  {
+    if (!m_Out)
+      return;
+    if (m_RowMajor)
+      RowMajorOutput();
+    else if ((m_XOrigin == 0) && (m_YOrigin == 0))
+    {
+      if (m_LUT)
+      {
+        ApplyOutputLUT(p_LED);
+        return;
+      }
+      memcpy(m_Out, p_LED, m_Width * m_Height * sizeof(struct CRGB));
+    }
+    else if ((tBWidth == 1) && (tBHeight == 1) && ((tMType == HORIZONTAL_MATRIX) || (tMType == VERTICAL_MATRIX)))
+    {
+      // Rows (horizontal) or columns (vertical) are contiguous, so the origin is a rotation of whole lines
+      // and a rotation within each line, both done with block copies
+      const bool Horiz = (tMType == HORIZONTAL_MATRIX);
+      const int16_t Lines = Horiz ? m_Height : m_Width;
+      const int16_t Len = Horiz ? m_Width : m_Height;
+      int16_t LOrg = Horiz ? m_YOrigin : m_XOrigin;
+      int16_t ROrg = Horiz ? m_XOrigin : m_YOrigin;
+      if ((Horiz ? tMHeight : tMWidth) < 0)
+        LOrg = (Lines - LOrg) % Lines;
+      if ((Horiz ? tMWidth : tMHeight) < 0)
+        ROrg = (Len - ROrg) % Len;
+      for (int16_t l = 0; l < Lines; ++l)
+      {
+        struct CRGB *Dst = &m_Out[l * Len];
+        struct CRGB *Src = &p_LED[((l + LOrg) % Lines) * Len];
+        memcpy(Dst, &Src[ROrg], (Len - ROrg) * sizeof(struct CRGB));
+        memcpy(&Dst[Len - ROrg], Src, ROrg * sizeof(struct CRGB));
+      }
+    }
+    else
+    {
+      for (int16_t y = 0; y < m_Height; ++y)
+      {
+        for (int16_t x = 0; x < m_Width; ++x)
+          m_Out[mXYLayout(x, y)] = p_LED[mXYDirect(x, y)];
+      }
+    }
+    if (m_LUT)
+      ApplyOutputLUT(m_Out);
+  }
+
+  using cLEDMatrixBase::operator();
+  // Hides the base class accessor so clipping and mapping are inlined, no virtual call
+  inline struct CRGB &operator()(int16_t x, int16_t y)
+  {
+    if ((x >= 0) && (x < (m_absMWidth * m_absBWidth)) && (y >= 0) && (y < (m_absMHeight * m_absBHeight)))
+      return (m_LED[mXYDirect(x, y)]);
+    else
+      return (m_OutOfBounds);
+  }
+
+  // Flash resident lookup of the same mapping, one entry per pixel
+  static uint32_t mXYTable(uint16_t x, uint16_t y)
+  {
+    static_assert((m_absMWidth * m_absBWidth * m_absMHeight * m_absBHeight) <= 65536, "XY table entries are 16 bit");
+    return (pgm_read_word(&m_XYTable.Index[(y * (m_absMWidth * m_absBWidth)) + x]));
+  }
+
+  // Plain arithmetic mapping, usable at compile time
+  static constexpr uint32_t mXYCalc(uint16_t x, uint16_t y)
   {
     if ((tBWidth == 1) && (tBHeight == 1))
     {
@@ -145,7 +353,7 @@ public:
       else if (tMHeight < 0)
         y = y - ((y % m_absMHeight) * 2) + (m_absMHeight - 1);
       // Calculate Block base
-      uint16_t Base;
+      uint16_t Base = 0;
       if (tBType == HORIZONTAL_BLOCKS)
         Base = (((y / m_absMHeight) * m_absBWidth) + (x / m_absMWidth)) * (m_absMWidth * m_absMHeight);
       else if (tBType == VERTICAL_BLOCKS)
@@ -188,16 +396,16 @@ public:
 
   void ShiftLeft(void)
   {
-    if ((tBWidth != 1) || (tBHeight != 1))
+    MarkDirty();
+    if (m_Out)
+      OriginShift(1, 0);
+    else if ((tBWidth != 1) || (tBHeight != 1))
     {
-      // Blocks, so no optimisation
-      for (int16_t x = 1; x < m_Width; ++x)
-      {
-        for (int16_t y = 0; y < m_Height; ++y)
-          m_LED[mXY(x - 1, y)] = m_LED[mXY(x, y)];
-      }
-      for (int16_t y = 0; y < m_Height; ++y)
-        m_LED[mXY(m_Width - 1, y)] = CRGB(0, 0, 0);
+      // Blocks, so move runs of pixels within and between the tiles
+      if ((tMType == HORIZONTAL_MATRIX) || (tMType == HORIZONTAL_ZIGZAG_MATRIX))
+        BlockShiftAlong(true, true);
+      else
+        BlockShiftAcross(false, true);
     }
     else
     {
@@ -234,16 +442,16 @@ public:
 
   void ShiftRight(void)
   {
-    if ((tBWidth != 1) || (tBHeight != 1))
+    MarkDirty();
+    if (m_Out)
+      OriginShift(-1, 0);
+    else if ((tBWidth != 1) || (tBHeight != 1))
     {
-      // Blocks, so no optimisation
-      for (int16_t x = m_Width - 1; x >= 1; --x)
-      {
-        for (int16_t y = 0; y < m_Height; ++y)
-          m_LED[mXY(x, y)] = m_LED[mXY(x - 1, y)];
-      }
-      for (int16_t y = 0; y < m_Height; ++y)
-        m_LED[mXY(0, y)] = CRGB(0, 0, 0);
+      // Blocks, so move runs of pixels within and between the tiles
+      if ((tMType == HORIZONTAL_MATRIX) || (tMType == HORIZONTAL_ZIGZAG_MATRIX))
+        BlockShiftAlong(true, false);
+      else
+        BlockShiftAcross(false, false);
     }
     else
     {
@@ -280,16 +488,16 @@ public:
 
   void ShiftDown(void)
   {
-    if ((tBWidth != 1) || (tBHeight != 1))
+    MarkDirty();
+    if (m_Out)
+      OriginShift(0, 1);
+    else if ((tBWidth != 1) || (tBHeight != 1))
     {
-      // Blocks, so no optimisation
-      for (int16_t y = 1; y < m_Height; ++y)
-      {
-        for (int16_t x = 0; x < m_Width; ++x)
-          m_LED[mXY(x, y - 1)] = m_LED[mXY(x, y)];
-      }
-      for (int16_t x = 0; x < m_Width; ++x)
-        m_LED[mXY(x, m_Height - 1)] = CRGB(0, 0, 0);
+      // Blocks, so move runs of pixels within and between the tiles
+      if ((tMType == HORIZONTAL_MATRIX) || (tMType == HORIZONTAL_ZIGZAG_MATRIX))
+        BlockShiftAcross(true, true);
+      else
+        BlockShiftAlong(false, true);
     }
     else
     {
@@ -326,16 +534,16 @@ public:
 
   void ShiftUp(void)
   {
-    if ((tBWidth != 1) || (tBHeight != 1))
+    MarkDirty();
+    if (m_Out)
+      OriginShift(0, -1);
+    else if ((tBWidth != 1) || (tBHeight != 1))
     {
-      // Blocks, so no optimisation
-      for (int16_t y = m_Height - 1; y >= 1; --y)
-      {
-        for (int16_t x = 0; x < m_Width; ++x)
-          m_LED[mXY(x, y)] = m_LED[mXY(x, y - 1)];
-      }
-      for (int16_t x = 0; x < m_Width; ++x)
-        m_LED[mXY(x, 0)] = CRGB(0, 0, 0);
+      // Blocks, so move runs of pixels within and between the tiles
+      if ((tMType == HORIZONTAL_MATRIX) || (tMType == HORIZONTAL_ZIGZAG_MATRIX))
+        BlockShiftAcross(true, false);
+      else
+        BlockShiftAlong(false, false);
     }
     else
     {
@@ -370,7 +578,231 @@ public:
     }
   }
 
+protected:
+  virtual void FillSpan(bool AlongX, int16_t a0, int16_t a1, int16_t c, CRGB Col)
+  {
+    if (m_RowMajor)
+    {
+      // Logical rows are contiguous up to the viewport wrap
+      if (AlongX)
+      {
+        int16_t y = c + m_YOrigin;
+        if (y >= m_Height)
+          y -= m_Height;
+        while (a0 <= a1)
+        {
+          int16_t x = a0 + m_XOrigin;
+          if (x >= m_Width)
+            x -= m_Width;
+          int16_t n = min((int16_t)((a1 - a0) + 1), (int16_t)(m_Width - x));
+          fill_solid(&p_LED[(y * m_Width) + x], n, Col);
+          a0 += n;
+        }
+      }
+      else
+      {
+        for (; a0 <= a1; ++a0)
+          p_LED[mXYDirect(c, a0)] = Col;
+      }
+      return;
+    }
+    const bool Natural = (AlongX != m_VerticalRuns);
+    const bool ZigZag = ((tMType == HORIZONTAL_ZIGZAG_MATRIX) || (tMType == VERTICAL_ZIGZAG_MATRIX));
+    if ((!Natural) && ZigZag)
+    {
+      // Across a zigzag the step alternates, so no runs
+      if (AlongX)
+      {
+        for (; a0 <= a1; ++a0)
+          p_LED[mXYDirect(a0, c)] = Col;
+      }
+      else
+      {
+        for (; a0 <= a1; ++a0)
+          p_LED[mXYDirect(c, a0)] = Col;
+      }
+      return;
+    }
+    // Otherwise the step is fixed up to the next tile edge or viewport wrap, both fall on tile boundaries
+    const int16_t Len = AlongX ? m_absMWidth : m_absMHeight;
+    const int16_t Total = AlongX ? m_Width : m_Height;
+    const int16_t Org = AlongX ? m_XOrigin : m_YOrigin;
+    int16_t cs = c + (AlongX ? m_YOrigin : m_XOrigin);
+    if (cs >= (AlongX ? m_Height : m_Width))
+      cs -= (AlongX ? m_Height : m_Width);
+    while (a0 <= a1)
+    {
+      int16_t as = a0 + Org;
+      if (as >= Total)
+        as -= Total;
+      int16_t n = min((int16_t)((a1 - a0) + 1), (int16_t)(Len - (as % Len)));
+      int32_t i, Step;
+      RunAt(AlongX, as, cs, i, Step);
+      a0 += n;
+      if (Step == 1)
+        fill_solid(&p_LED[i], n, Col);
+      else if (Step == -1)
+        fill_solid(&p_LED[(i - n) + 1], n, Col);
+      else
+      {
+        for (; n > 0; --n, i += Step)
+          p_LED[i] = Col;
+      }
+    }
+  }
+
 private:
+  // Viewport shift, moves the origin by one pixel and clears the line that enters the view
+  void OriginShift(int8_t dx, int8_t dy)
+  {
+    if (dx)
+    {
+      m_XOrigin = (m_XOrigin + m_Width + dx) % m_Width;
+      int16_t x = (dx > 0) ? (m_Width - 1) : 0;
+      for (int16_t y = 0; y < m_Height; ++y)
+        p_LED[mXYDirect(x, y)] = CRGB(0, 0, 0);
+    }
+    if (dy)
+    {
+      m_YOrigin = (m_YOrigin + m_Height + dy) % m_Height;
+      int16_t y = (dy > 0) ? (m_Height - 1) : 0;
+      for (int16_t x = 0; x < m_Width; ++x)
+        p_LED[mXYDirect(x, y)] = CRGB(0, 0, 0);
+    }
+  }
+
+  // Run helpers used by the Shift and Span functions. A run is one tile row (AlongX) or one tile
+  // column of pixels, within a tile its indexes change by a fixed step (except across a zigzag).
+  inline int32_t RunIndex(bool AlongX, int16_t a, int16_t c)
+  {
+    if (AlongX)
+      return (mXYLayout(a, c));
+    else
+      return (mXYLayout(c, a));
+  }
+  inline void RunAt(bool AlongX, int16_t a, int16_t c, int32_t &Start, int32_t &Step)
+  {
+    const int16_t Len = AlongX ? m_absMWidth : m_absMHeight;
+    Start = RunIndex(AlongX, a, c);
+    if (Len == 1)
+      Step = 1;
+    else if (((a + 1) % Len) != 0)
+      Step = RunIndex(AlongX, a + 1, c) - Start;
+    else
+      Step = Start - RunIndex(AlongX, a - 1, c);
+  }
+  // Copies the logical row major array into chain order, one run of the layout at a time
+  void RowMajorOutput()
+  {
+    const bool AlongX = !m_VerticalRuns;
+    const int16_t Len = AlongX ? m_absMWidth : m_absMHeight;
+    const int16_t Total = AlongX ? m_Width : m_Height;
+    const int16_t Lines = AlongX ? m_Height : m_Width;
+    const int16_t Org = AlongX ? m_XOrigin : m_YOrigin;
+    const int16_t LOrg = AlongX ? m_YOrigin : m_XOrigin;
+    const int32_t SStep = AlongX ? 1 : m_Width;
+    int32_t Dst, DStep, Src;
+    for (int16_t c = 0; c < Lines; ++c)
+    {
+      int16_t cs = c + LOrg;
+      if (cs >= Lines)
+        cs -= Lines;
+      for (int16_t a = 0; a < Total;)
+      {
+        int16_t as = a + Org;
+        if (as >= Total)
+          as -= Total;
+        // Up to the next tile edge or the wrap of the source line
+        int16_t n = min((int16_t)(Len - (a % Len)), (int16_t)(Total - as));
+        RunAt(AlongX, a, c, Dst, DStep);
+        Src = AlongX ? ((cs * m_Width) + as) : ((as * m_Width) + cs);
+        a += n;
+        if ((DStep == 1) && (SStep == 1))
+          memcpy(&m_Out[Dst], &p_LED[Src], n * sizeof(struct CRGB));
+        else
+        {
+          for (; n > 0; --n, Dst += DStep, Src += SStep)
+            m_Out[Dst] = p_LED[Src];
+        }
+      }
+    }
+  }
+  void RunMove(int32_t Dst, int32_t DStep, int32_t Src, int32_t SStep, int16_t Len)
+  {
+    if ((DStep == SStep) && ((DStep == 1) || (DStep == -1)))
+    {
+      if (DStep < 0)
+      {
+        Dst -= (Len - 1);
+        Src -= (Len - 1);
+      }
+      if (Len > 0)
+        memmove(&p_LED[Dst], &p_LED[Src], Len * sizeof(struct CRGB));
+    }
+    else
+    {
+      for (; Len > 0; --Len, Dst += DStep, Src += SStep)
+        p_LED[Dst] = p_LED[Src];
+    }
+  }
+  // Shift along the runs, Forward moves pixels towards the lower coordinate
+  void BlockShiftAlong(bool AlongX, bool Forward)
+  {
+    const int16_t Len = AlongX ? m_absMWidth : m_absMHeight;
+    const int16_t Blocks = AlongX ? m_absBWidth : m_absBHeight;
+    const int16_t Lines = AlongX ? m_Height : m_Width;
+    int32_t Start, Step, Last;
+    for (int16_t c = 0; c < Lines; ++c)
+    {
+      for (int16_t b = 0; b < Blocks; ++b)
+      {
+        int16_t a = (Forward ? b : ((Blocks - 1) - b)) * Len;
+        RunAt(AlongX, a, c, Start, Step);
+        Last = Start + ((Len - 1) * Step);
+        if (Forward)
+        {
+          RunMove(Start, Step, Start + Step, Step, Len - 1);
+          if ((a + Len) < (Blocks * Len))
+            p_LED[Last] = p_LED[RunIndex(AlongX, a + Len, c)];
+          else
+            p_LED[Last] = CRGB(0, 0, 0);
+        }
+        else
+        {
+          RunMove(Last, -Step, Last - Step, -Step, Len - 1);
+          if (a > 0)
+            p_LED[Start] = p_LED[RunIndex(AlongX, a - 1, c)];
+          else
+            p_LED[Start] = CRGB(0, 0, 0);
+        }
+      }
+    }
+  }
+  // Shift across the runs, whole runs are copied from the neighbouring line
+  void BlockShiftAcross(bool AlongX, bool Forward)
+  {
+    const int16_t Len = AlongX ? m_absMWidth : m_absMHeight;
+    const int16_t Blocks = AlongX ? m_absBWidth : m_absBHeight;
+    const int16_t Lines = AlongX ? m_Height : m_Width;
+    int32_t Dst, DStep, Src, SStep;
+    for (int16_t i = 0; i < (Lines - 1); ++i)
+    {
+      int16_t c = Forward ? i : ((Lines - 1) - i);
+      for (int16_t b = 0; b < Blocks; ++b)
+      {
+        RunAt(AlongX, b * Len, c, Dst, DStep);
+        RunAt(AlongX, b * Len, Forward ? (c + 1) : (c - 1), Src, SStep);
+        RunMove(Dst, DStep, Src, SStep, Len);
+      }
+    }
+    for (int16_t b = 0; b < Blocks; ++b)
+    {
+      RunAt(AlongX, b * Len, Forward ? (Lines - 1) : 0, Dst, DStep);
+      for (int16_t l = Len; l > 0; --l, Dst += DStep)
+        p_LED[Dst] = CRGB(0, 0, 0);
+    }
+  }
+
   // Optimised functions used by ShiftLeft & ShiftRight in non block mode
   void HPWSL(void)
   {
@@ -616,4 +1048,7 @@ private:
   }
 };
 
+template <int16_t tMWidth, int16_t tMHeight, MatrixType_t tMType, int8_t tBWidth, int8_t tBHeight, BlockType_t tBType>
+const typename cLEDMatrix<tMWidth, tMHeight, tMType, tBWidth, tBHeight, tBType>::cXYTable cLEDMatrix<tMWidth, tMHeight, tMType, tBWidth, tBHeight, tBType>::m_XYTable PROGMEM;
+
 #endif
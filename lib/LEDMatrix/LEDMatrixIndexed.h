@@ -0,0 +1,333 @@
+/*
+  Palette indexed matrix, one byte per LED
+
+  Same template parameters and layout as cLEDMatrix, but the drawing array holds
+  8 bit palette indexes in logical row major order (y * Width + x). RenderOutput()
+  looks the indexes up in the palette and writes them into the CRGB output array
+  in chain order, so the palette is only applied to what changed and FastLED still
+  gets a normal CRGB array.
+
+  cLEDTextDirect can draw into it with SetTextColrOptions(COLR_INDEX | ...), the
+  text colours are then palette indexes. Colours cannot be written to an index,
+  drawing code meant for a CRGB matrix does not compile against this one.
+*/
+
+#ifndef LEDMatrixIndexed_h
+#define LEDMatrixIndexed_h
+
+#include <LEDMatrix.h>
+
+template <int16_t tMWidth, int16_t tMHeight, MatrixType_t tMType, int8_t tBWidth = 1, int8_t tBHeight = 1, BlockType_t tBType = HORIZONTAL_BLOCKS>
+class cLEDMatrixIndexed
+{
+public:
+  // Reference to one index
+  class cIndexRef
+  {
+  private:
+    uint8_t &m_Index;
+
+  public:
+    cIndexRef(uint8_t &Index) : m_Index(Index) {}
+    operator uint8_t() const { return (m_Index); }
+    cIndexRef &operator=(uint8_t Index) { m_Index = Index; return (*this); }
+    cIndexRef &operator=(const cIndexRef &Ref) { m_Index = Ref.m_Index; return (*this); }
+    cIndexRef &operator=(const CRGB &Col) = delete;   // A colour is not an index, look it up in the palette first
+    cIndexRef &operator=(const CHSV &Col) = delete;
+    cIndexRef &nscale8(uint8_t Scale) { m_Index = scale8(m_Index, Scale); return (*this); }
+  };
+
+private:
+  typedef cLEDMatrix<tMWidth, tMHeight, tMType, tBWidth, tBHeight, tBType> tLayout;
+  static const int16_t m_Width = (tMWidth * ((tMWidth < 0) * -1 + (tMWidth > 0))) * (tBWidth * ((tBWidth < 0) * -1 + (tBWidth > 0)));
+  static const int16_t m_Height = (tMHeight * ((tMHeight < 0) * -1 + (tMHeight > 0))) * (tBHeight * ((tBHeight < 0) * -1 + (tBHeight > 0)));
+  uint8_t *m_Index;
+  uint8_t m_OutOfBounds;
+  struct CRGB *m_Out;
+  CRGBPalette16 m_Palette16;
+  const CRGBPalette256 *m_Palette256;
+  int16_t m_DirtyX0, m_DirtyY0, m_DirtyX1, m_DirtyY1;   // Changed area since the last RenderOutput(), empty when X0 > X1
+  uint16_t m_Changes;
+
+public:
+  cLEDMatrixIndexed()
+  {
+    m_Index = (uint8_t *)calloc(m_Width * m_Height, sizeof(uint8_t));
+    if (!m_Index)
+    {
+      Serial.begin(115200);
+      Serial.println("Malloc LEDMatrixIndexed Failed");
+      while (1)
+        ;
+    }
+    m_Out = NULL;
+    m_Palette16 = CRGBPalette16(CRGB::Black, CRGB::White);
+    m_Palette256 = NULL;
+    m_Changes = 0;
+    MarkDirty();
+  }
+
+  int Size() { return (m_Width * m_Height); }
+  int Width() { return (m_Width); }
+  int Height() { return (m_Height); }
+  uint8_t *IndexArray() { return (m_Index); }
+
+  // CRGB array given to FastLED, filled by RenderOutput()
+  void SetOutputArray(struct CRGB *pOut)
+  {
+    m_Out = pOut;
+    MarkDirty();
+  }
+  struct CRGB *OutputArray() { return (m_Out); }
+  // A 16 entry palette is interpolated per LED, a 256 entry one (kept by the caller) is a plain lookup
+  void SetPalette(const CRGBPalette16 &Palette)
+  {
+    m_Palette16 = Palette;
+    m_Palette256 = NULL;
+    MarkDirty();
+  }
+  void SetPalette(const CRGBPalette256 *pPalette)
+  {
+    m_Palette256 = pPalette;
+    MarkDirty();
+  }
+
+  inline cIndexRef operator()(int16_t x, int16_t y)
+  {
+    if ((x >= 0) && (x < m_Width) && (y >= 0) && (y < m_Height))
+      return (cIndexRef(m_Index[(y * m_Width) + x]));
+    m_OutOfBounds = 0;
+    return (cIndexRef(m_OutOfBounds));
+  }
+
+  void MarkDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+  {
+    if (x0 > x1)
+    {
+      int16_t t = x0;
+      x0 = x1;
+      x1 = t;
+    }
+    if (y0 > y1)
+    {
+      int16_t t = y0;
+      y0 = y1;
+      y1 = t;
+    }
+    if ((x1 < 0) || (y1 < 0) || (x0 >= m_Width) || (y0 >= m_Height))
+      return;
+    x0 = max(x0, (int16_t)0);
+    y0 = max(y0, (int16_t)0);
+    x1 = min(x1, (int16_t)(m_Width - 1));
+    y1 = min(y1, (int16_t)(m_Height - 1));
+    if (m_DirtyX0 > m_DirtyX1)
+    {
+      m_DirtyX0 = x0;
+      m_DirtyY0 = y0;
+      m_DirtyX1 = x1;
+      m_DirtyY1 = y1;
+    }
+    else
+    {
+      m_DirtyX0 = min(m_DirtyX0, x0);
+      m_DirtyY0 = min(m_DirtyY0, y0);
+      m_DirtyX1 = max(m_DirtyX1, x1);
+      m_DirtyY1 = max(m_DirtyY1, y1);
+    }
+    m_Changes++;
+  }
+  void MarkDirty() { m_DirtyX0 = 1; m_DirtyX1 = 0; MarkDirty(0, 0, m_Width - 1, m_Height - 1); }
+  void ClearDirty() { m_DirtyX0 = 1; m_DirtyX1 = 0; }
+  bool IsDirty() { return (m_DirtyX0 <= m_DirtyX1); }
+  uint16_t ChangeCount() { return (m_Changes); }
+
+  // Expands the changed area through the palette into the output array
+  void RenderOutput()
+  {
+    if ((!m_Out) || (m_DirtyX0 > m_DirtyX1))
+      return;
+    for (int16_t y = m_DirtyY0; y <= m_DirtyY1; ++y)
+    {
+      const uint8_t *pIndex = &m_Index[(y * m_Width) + m_DirtyX0];
+      for (int16_t x = m_DirtyX0; x <= m_DirtyX1; ++x, ++pIndex)
+      {
+        if (m_Palette256)
+          m_Out[tLayout::mXYLayout(x, y)] = (*m_Palette256)[*pIndex];
+        else
+          m_Out[tLayout::mXYLayout(x, y)] = ColorFromPalette(m_Palette16, *pIndex);
+      }
+    }
+    ClearDirty();
+  }
+  // Renders and calls FastLED.show() only if something changed since the last call
+  bool Show()
+  {
+    if (m_DirtyX0 > m_DirtyX1)
+      return (false);
+    RenderOutput();
+    FastLED.show();
+    return (true);
+  }
+
+  void Fill(uint8_t Index)
+  {
+    memset(m_Index, Index, m_Width * m_Height);
+    MarkDirty();
+  }
+
+  void ShiftLeft()
+  {
+    for (int16_t y = 0; y < m_Height; ++y)
+    {
+      memmove(&m_Index[y * m_Width], &m_Index[(y * m_Width) + 1], m_Width - 1);
+      m_Index[(y * m_Width) + m_Width - 1] = 0;
+    }
+    MarkDirty();
+  }
+  void ShiftRight()
+  {
+    for (int16_t y = 0; y < m_Height; ++y)
+    {
+      memmove(&m_Index[(y * m_Width) + 1], &m_Index[y * m_Width], m_Width - 1);
+      m_Index[y * m_Width] = 0;
+    }
+    MarkDirty();
+  }
+  void ShiftDown()
+  {
+    memmove(m_Index, &m_Index[m_Width], (m_Height - 1) * m_Width);
+    memset(&m_Index[(m_Height - 1) * m_Width], 0, m_Width);
+    MarkDirty();
+  }
+  void ShiftUp()
+  {
+    memmove(&m_Index[m_Width], m_Index, (m_Height - 1) * m_Width);
+    memset(m_Index, 0, m_Width);
+    MarkDirty();
+  }
+
+  void DrawPixel(int16_t x, int16_t y, uint8_t Index)
+  {
+    if ((x >= 0) && (x < m_Width) && (y >= 0) && (y < m_Height))
+    {
+      m_Index[(y * m_Width) + x] = Index;
+      MarkDirty(x, y, x, y);
+    }
+  }
+  void DrawHSpan(int16_t x0, int16_t x1, int16_t y, uint8_t Index)
+  {
+    if (x0 > x1)
+    {
+      int16_t t = x0;
+      x0 = x1;
+      x1 = t;
+    }
+    x0 = max(x0, (int16_t)0);
+    x1 = min(x1, (int16_t)(m_Width - 1));
+    if ((y < 0) || (y >= m_Height) || (x0 > x1))
+      return;
+    memset(&m_Index[(y * m_Width) + x0], Index, (x1 - x0) + 1);
+    MarkDirty(x0, y, x1, y);
+  }
+  void DrawVSpan(int16_t x, int16_t y0, int16_t y1, uint8_t Index)
+  {
+    if (y0 > y1)
+    {
+      int16_t t = y0;
+      y0 = y1;
+      y1 = t;
+    }
+    y0 = max(y0, (int16_t)0);
+    y1 = min(y1, (int16_t)(m_Height - 1));
+    if ((x < 0) || (x >= m_Width) || (y0 > y1))
+      return;
+    MarkDirty(x, y0, x, y1);
+    for (uint8_t *p = &m_Index[(y0 * m_Width) + x]; y0 <= y1; ++y0, p += m_Width)
+      *p = Index;
+  }
+  void DrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t Index)
+  {
+    if (y0 == y1)
+    {
+      DrawHSpan(x0, x1, y0, Index);
+      return;
+    }
+    if (x0 == x1)
+    {
+      DrawVSpan(x0, y0, y1, Index);
+      return;
+    }
+    MarkDirty(x0, y0, x1, y1);
+    int16_t dx = x1 - x0;
+    int16_t dy = y1 - y0;
+    if (abs(dx) >= abs(dy))
+    {
+      int32_t f = ((int32_t)dy << 16) / (int32_t)abs(dx);
+      int32_t y = ((int32_t)y0 << 16) + 32768;
+      for (int8_t s = (dx >= 0) ? 1 : -1; x0 != (x1 + s); x0 += s, y += f)
+        (*this)(x0, (y >> 16)) = Index;
+    }
+    else
+    {
+      int32_t f = ((int32_t)dx << 16) / (int32_t)abs(dy);
+      int32_t x = ((int32_t)x0 << 16) + 32768;
+      for (int8_t s = (dy >= 0) ? 1 : -1; y0 != (y1 + s); y0 += s, x += f)
+        (*this)((x >> 16), y0) = Index;
+    }
+  }
+  void DrawRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t Index)
+  {
+    DrawLine(x0, y0, x0, y1, Index);
+    DrawLine(x0, y1, x1, y1, Index);
+    DrawLine(x1, y1, x1, y0, Index);
+    DrawLine(x1, y0, x0, y0, Index);
+  }
+  void DrawCircle(int16_t xc, int16_t yc, uint16_t r, uint8_t Index)
+  {
+    MarkDirty(xc - r, yc - r, xc + r, yc + r);
+    int16_t x = -r;
+    int16_t y = 0;
+    int16_t e = 2 - (2 * r);
+    do
+    {
+      (*this)(xc + x, yc - y) = Index;
+      (*this)(xc - x, yc + y) = Index;
+      (*this)(xc + y, yc + x) = Index;
+      (*this)(xc - y, yc - x) = Index;
+      int16_t _e = e;
+      if (_e <= y)
+        e += (++y * 2) + 1;
+      if ((_e > x) || (e > y))
+        e += (++x * 2) + 1;
+    }
+    while (x < 0);
+  }
+  void DrawFilledRectangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t Index)
+  {
+    for (int16_t y = max(min(y0, y1), (int16_t)0); y <= min(max(y0, y1), (int16_t)(m_Height - 1)); ++y)
+      DrawHSpan(x0, x1, y, Index);
+  }
+  void DrawFilledCircle(int16_t xc, int16_t yc, uint16_t r, uint8_t Index)
+  {
+    int16_t x = r;
+    int16_t y = 0;
+    int16_t e = 1 - x;
+    while (x >= y)
+    {
+      DrawHSpan(xc - x, xc + x, yc + y, Index);
+      DrawHSpan(xc - y, xc + y, yc + x, Index);
+      DrawHSpan(xc - x, xc + x, yc - y, Index);
+      DrawHSpan(xc - y, xc + y, yc - x, Index);
+      ++y;
+      if (e >= 0)
+      {
+        --x;
+        e += 2 * ((y - x) + 1);
+      }
+      else
+        e += (2 * y) + 1;
+    }
+  }
+};
+
+#endif
@@ -0,0 +1,84 @@
+#include <FastLED.h>        //https://github.com/FastLED/FastLED
+#include <LEDMatrix.h>      //https://github.com/Jorgen-VikingGod/LEDMatrix
+
+// Frame rate model for a tiled wall split into parallel output segments.
+// Prints ShowMicros() based frame rates for 1 to MAX_SEGMENTS segments and a few
+// wall sizes, then measures FastLED.show() for the segments configured below so
+// the model can be checked against the hardware. Without LEDs connected (or on a
+// PC) only the model part is meaningful.
+
+#define COLOR_ORDER         GRB
+#define CHIPSET             WS2812B
+#define DATA_PIN            12
+
+#define MATRIX_TILE_WIDTH   8  // width of EACH NEOPIXEL MATRIX (not total display)
+#define MATRIX_TILE_HEIGHT  8  // height of each matrix
+#define MATRIX_TILE_H       4  // number of matrices arranged horizontally
+#define MATRIX_TILE_V       1  // number of matrices arranged vertically
+
+#define SEGMENTS            4  // should divide MATRIX_TILE_H * MATRIX_TILE_V
+#define MAX_SEGMENTS        8
+#define TARGET_FPS          60
+
+cLEDMatrix<MATRIX_TILE_WIDTH, MATRIX_TILE_HEIGHT, VERTICAL_ZIGZAG_MATRIX, MATRIX_TILE_H, MATRIX_TILE_V, HORIZONTAL_BLOCKS> leds;
+
+void PrintModel(uint32_t Leds)
+{
+  Serial.print(Leds);
+  Serial.print(" LEDs:");
+  for (uint8_t s = 1; s <= MAX_SEGMENTS; ++s)
+  {
+    uint32_t t = cLEDMatrixBase::ShowMicros(Leds, s);
+    Serial.print("  ");
+    Serial.print(s);
+    Serial.print("x ");
+    Serial.print(1000000UL / t);
+    Serial.print("fps");
+    if ((1000000UL / t) < TARGET_FPS)
+      Serial.print("*");
+  }
+  Serial.println();
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+
+  Serial.print("Model, 24 bits/LED at 1250ns + 280us latch, * = below ");
+  Serial.print(TARGET_FPS);
+  Serial.println("fps");
+  for (uint32_t Leds = 256; Leds <= 8192; Leds *= 2)
+    PrintModel(Leds);
+
+#ifdef PORTA_FIRST_PIN
+  // Block output, segment n on pin PORTA_FIRST_PIN + n
+  FastLED.addLeds<WS2811_PORTA, SEGMENTS, COLOR_ORDER>(leds.Segment(0, SEGMENTS), leds.SegmentSize(SEGMENTS));
+#else
+  // No block output on this platform, all segments on one pin so only the sequential time is measured
+  FastLED.addLeds<CHIPSET, DATA_PIN, COLOR_ORDER>(leds[0], leds.Size());
+#endif
+  FastLED.setBrightness(32);
+  leds.DrawFilledRectangle(0, 0, leds.Width() - 1, leds.Height() - 1, CRGB(0, 0, 64));
+
+  uint32_t t = micros();
+  for (uint8_t i = 0; i < 20; ++i)
+    FastLED.show();
+  t = (micros() - t) / 20;
+  Serial.print("Measured ");
+  Serial.print(leds.Size());
+  Serial.print(" LEDs: ");
+  Serial.print(t);
+  Serial.print("us/show, model ");
+#ifdef PORTA_FIRST_PIN
+  Serial.print(cLEDMatrixBase::ShowMicros(leds.Size(), SEGMENTS));
+#else
+  Serial.print(cLEDMatrixBase::ShowMicros(leds.Size(), 1));
+#endif
+  Serial.println("us");
+}
+
+
+void loop()
+{
+}
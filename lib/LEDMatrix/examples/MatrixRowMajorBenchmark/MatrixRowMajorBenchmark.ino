@@ -0,0 +1,85 @@
+#include <FastLED.h>        //https://github.com/FastLED/FastLED
+#include <LEDMatrix.h>      //https://github.com/Jorgen-VikingGod/LEDMatrix
+
+// Compares drawing straight into the chain ordered LED array with drawing into
+// a logical row major array that RenderOutput() remaps once per frame.
+// Times include the RenderOutput() pass, but not FastLED.show().
+
+#define MATRIX_TILE_WIDTH   8  // width of EACH NEOPIXEL MATRIX (not total display)
+#define MATRIX_TILE_HEIGHT  8  // height of each matrix
+#define MATRIX_TILE_H       4  // number of matrices arranged horizontally
+#define MATRIX_TILE_V       2  // number of matrices arranged vertically
+#define MATRIX_WIDTH        (MATRIX_TILE_WIDTH * MATRIX_TILE_H)
+#define MATRIX_HEIGHT       (MATRIX_TILE_HEIGHT * MATRIX_TILE_V)
+#define NUM_LEDS            (MATRIX_WIDTH * MATRIX_HEIGHT)
+
+#define FRAMES              50
+
+cLEDMatrix<MATRIX_TILE_WIDTH, MATRIX_TILE_HEIGHT, HORIZONTAL_ZIGZAG_MATRIX, MATRIX_TILE_H, MATRIX_TILE_V, VERTICAL_BLOCKS> leds;
+struct CRGB frame[NUM_LEDS];
+
+// Scroll one column left and draw a new column, as the text scroller does
+uint32_t TextScroll()
+{
+  uint32_t t = micros();
+  for (uint16_t f = 0; f < FRAMES; ++f)
+  {
+    leds.ShiftLeft();
+    for (int16_t y = 0; y < leds.Height(); ++y)
+    {
+      if ((f + y) & 2)
+        leds(leds.Width() - 1, y) = CRGB::White;
+    }
+    leds.MarkDirty(leds.Width() - 1, 0, leds.Width() - 1, leds.Height() - 1);
+    leds.RenderOutput();
+  }
+  return (micros() - t);
+}
+
+// Every pixel rewritten each frame
+uint32_t FullFrame()
+{
+  uint32_t t = micros();
+  for (uint16_t f = 0; f < FRAMES; ++f)
+  {
+    for (int16_t y = 0; y < leds.Height(); ++y)
+    {
+      for (int16_t x = 0; x < leds.Width(); ++x)
+        leds(x, y) = CHSV((x * 8) + (y * 4) + f, 255, 255);
+    }
+    leds.MarkDirty();
+    leds.RenderOutput();
+  }
+  return (micros() - t);
+}
+
+void Report(const char *Name)
+{
+  Serial.print(Name);
+  Serial.print("  text scroll ");
+  Serial.print(TextScroll() / FRAMES);
+  Serial.print("us/frame  full frame ");
+  Serial.print(FullFrame() / FRAMES);
+  Serial.println("us/frame");
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+  Serial.print(MATRIX_WIDTH);
+  Serial.print("x");
+  Serial.println(MATRIX_HEIGHT);
+
+  leds.SetOutputArray(NULL);
+  Report("physical  ");
+  leds.SetOutputArray(frame);
+  Report("viewport  ");
+  leds.SetOutputArray(frame, true);
+  Report("row major ");
+}
+
+
+void loop()
+{
+}
@@ -0,0 +1,84 @@
+#include <FastLED.h>        //https://github.com/FastLED/FastLED
+#include <LEDMatrix.h>      //https://github.com/Jorgen-VikingGod/LEDMatrix
+
+// Compares the arithmetic mXYCalc() mapping with the flash resident mXYTable()
+// lookup for every MatrixType_t x BlockType_t combination.
+// Build with -DLEDMATRIX_XY_TABLE to make mXY() (and so all drawing) use the table.
+
+#define MATRIX_TILE_WIDTH   8  // width of EACH NEOPIXEL MATRIX (not total display)
+#define MATRIX_TILE_HEIGHT  8  // height of each matrix
+#define MATRIX_TILE_H       4  // number of matrices arranged horizontally
+#define MATRIX_TILE_V       2  // number of matrices arranged vertically
+
+#define PASSES              20
+
+volatile uint32_t sink;
+
+template <class tMatrix>
+void Benchmark(const char *Name)
+{
+  const uint16_t Width = MATRIX_TILE_WIDTH * MATRIX_TILE_H;
+  const uint16_t Height = MATRIX_TILE_HEIGHT * MATRIX_TILE_V;
+  uint32_t Sum, tCalc, tTable;
+
+  Sum = 0;
+  tCalc = micros();
+  for (uint8_t p = 0; p < PASSES; ++p)
+  {
+    for (uint16_t y = 0; y < Height; ++y)
+    {
+      for (uint16_t x = 0; x < Width; ++x)
+        Sum += tMatrix::mXYCalc(x, y);
+    }
+  }
+  tCalc = micros() - tCalc;
+  sink = Sum;
+
+  Sum = 0;
+  tTable = micros();
+  for (uint8_t p = 0; p < PASSES; ++p)
+  {
+    for (uint16_t y = 0; y < Height; ++y)
+    {
+      for (uint16_t x = 0; x < Width; ++x)
+        Sum += tMatrix::mXYTable(x, y);
+    }
+  }
+  tTable = micros() - tTable;
+  if (Sum != sink)
+    Serial.println("  MISMATCH between mXYCalc and mXYTable");
+
+  Serial.print(Name);
+  Serial.print("  calc ");
+  Serial.print(tCalc);
+  Serial.print("us  table ");
+  Serial.print(tTable);
+  Serial.println("us");
+}
+
+#define BENCH_BLOCKS(MTYPE) \
+  Benchmark<cLEDMatrix<MATRIX_TILE_WIDTH, MATRIX_TILE_HEIGHT, MTYPE, MATRIX_TILE_H, MATRIX_TILE_V, HORIZONTAL_BLOCKS> >(#MTYPE " / HORIZONTAL_BLOCKS"); \
+  Benchmark<cLEDMatrix<MATRIX_TILE_WIDTH, MATRIX_TILE_HEIGHT, MTYPE, MATRIX_TILE_H, MATRIX_TILE_V, VERTICAL_BLOCKS> >(#MTYPE " / VERTICAL_BLOCKS"); \
+  Benchmark<cLEDMatrix<MATRIX_TILE_WIDTH, MATRIX_TILE_HEIGHT, MTYPE, MATRIX_TILE_H, MATRIX_TILE_V, HORIZONTAL_ZIGZAG_BLOCKS> >(#MTYPE " / HORIZONTAL_ZIGZAG_BLOCKS"); \
+  Benchmark<cLEDMatrix<MATRIX_TILE_WIDTH, MATRIX_TILE_HEIGHT, MTYPE, MATRIX_TILE_H, MATRIX_TILE_V, VERTICAL_ZIGZAG_BLOCKS> >(#MTYPE " / VERTICAL_ZIGZAG_BLOCKS");
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+  Serial.print("mXY timing, ");
+  Serial.print(PASSES);
+  Serial.print(" passes over ");
+  Serial.print(MATRIX_TILE_WIDTH * MATRIX_TILE_H);
+  Serial.print("x");
+  Serial.println(MATRIX_TILE_HEIGHT * MATRIX_TILE_V);
+  BENCH_BLOCKS(HORIZONTAL_MATRIX)
+  BENCH_BLOCKS(VERTICAL_MATRIX)
+  BENCH_BLOCKS(HORIZONTAL_ZIGZAG_MATRIX)
+  BENCH_BLOCKS(VERTICAL_ZIGZAG_MATRIX)
+}
+
+
+void loop()
+{
+}
@@ -1,7 +1,7 @@
 #ifndef ComicSansP24_h
 #define ComicSansP24_h
 
-const uint8_t ComicSansP24Data[] = {
+const uint8_t ComicSansP24Data[] PROGMEM = {
 			FONT_PROPORTIONAL | 20,  // Font Maximum Width
 			24,  // Font Height
 			32, // Font First Character
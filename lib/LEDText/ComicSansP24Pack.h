@@ -0,0 +1,121 @@
+#ifndef ComicSansP24Pack_h
+#define ComicSansP24Pack_h
+
+// ComicSansP24.h packed by the FontPack example, 7012 bytes down to 2729
+const uint8_t ComicSansP24PackData[] PROGMEM = {
+			FONT_PROPORTIONAL | 20,  // Font Width
+			FONT_PACKED | 24,  // Font Height
+			32, // Font First Character
+			127,// Font Last Character
+			8,3,6,19,14,17,15,2,7,7,11,10,4,9,3,11,
+			12,9,11,11,14,12,12,13,12,12,3,5,7,9,9,11,
+			19,15,12,13,14,12,12,15,15,11,15,12,12,18,17,16,
+			11,20,13,15,16,15,14,20,16,15,15,6,10,6,11,16,
+			6,11,12,11,12,11,10,11,10,3,8,11,3,15,10,11,
+			10,11,10,10,11,10,11,15,12,12,11,9,3,9,13,14,  // Glyph widths
+			0x00,0x00,0x00,0x00,0x09,0x00,0x11,0x00,0x3E,0x00,0x6A,0x00,0x91,0x00,0xB7,0x00,0xBB,0x00,0xD2,0x00,0xE9,0x00,0xF8,0x00,0x07,0x01,0x0C,0x01,0x11,0x01,0x15,0x01,
+			0x30,0x01,0x4D,0x01,0x63,0x01,0x7D,0x01,0x98,0x01,0xBA,0x01,0xD7,0x01,0xF4,0x01,0x12,0x02,0x2F,0x02,0x4B,0x02,0x52,0x02,0x5E,0x02,0x69,0x02,0x72,0x02,0x81,0x02,
+			0x9B,0x02,0xCD,0x02,0xF1,0x02,0x0E,0x03,0x2E,0x03,0x50,0x03,0x6D,0x03,0x8A,0x03,0xAE,0x03,0xD2,0x03,0xED,0x03,0x11,0x04,0x30,0x04,0x4D,0x04,0x78,0x04,0xA1,0x04,
+			0xC7,0x04,0xE2,0x04,0x19,0x05,0x39,0x05,0x5D,0x05,0x83,0x05,0xA7,0x05,0xC9,0x05,0xF8,0x05,0x1E,0x06,0x42,0x06,0x66,0x06,0x7A,0x06,0x94,0x06,0xA8,0x06,0xB3,0x06,
+			0xB9,0x06,0xBF,0x06,0xD3,0x06,0xF2,0x06,0x06,0x07,0x25,0x07,0x39,0x07,0x56,0x07,0x71,0x07,0x8B,0x07,0x94,0x07,0xAD,0x07,0xCA,0x07,0xD4,0x07,0xF3,0x07,0x06,0x08,
+			0x1A,0x08,0x33,0x08,0x4E,0x08,0x61,0x08,0x74,0x08,0x8E,0x08,0xA1,0x08,0xB5,0x08,0xD0,0x08,0xE6,0x08,0x03,0x09,0x17,0x09,0x32,0x09,0x3D,0x09,0x58,0x09,0x63,0x09,
+			0x83,0x09,  // Glyph offsets
+			  // 0x20
+			0x00,0x12,0xFF,0xFF,0xFF,0xFF,0xFF,0xC6,0xEC,  // !
+			0x00,0x07,0xCF,0x3C,0xF3,0xCF,0x3C,0xC0,  // "
+			0x00,0x12,0x00,0xC3,0x80,0x38,0x70,0x07,0x0E,0x01,0xE3,0x83,0xFF,0xFE,0x7F,0xFF,0xCF,0xFF,0xF8,0x3C,0x70,0x07,0x0E,0x00,0xE3,0x80,0x38,0x70,0x7F,0xFF,0xEF,0xFF,0xFD,0xFF,0xFF,0x87,0x0E,0x01,0xE3,0x80,0x38,0x70,0x07,0x0E,0x00,  // #
+			0x00,0x18,0x07,0x00,0x1C,0x00,0x70,0x03,0xF8,0x3F,0xF9,0xFF,0xE7,0x70,0x39,0xC0,0xE7,0x03,0xDC,0x0F,0xFE,0x1F,0xFC,0x1F,0xF8,0x1C,0xF0,0x71,0xC1,0xC7,0x07,0x1F,0x9D,0xFF,0xFF,0xBF,0xFC,0x7F,0xC0,0x1C,0x00,0x70,0x01,0xC0,  // $
+			0x01,0x11,0x3C,0x18,0x3F,0x1C,0x3F,0xDC,0x1C,0xEE,0x0E,0x7E,0x07,0x3F,0x03,0xFF,0x00,0xFF,0x80,0x3D,0x9E,0x01,0xDF,0x81,0xDF,0xE0,0xEE,0x70,0xE7,0x38,0x73,0x9C,0x71,0xFE,0x38,0x7E,0x18,0x1E,0x00,  // %
+			0x01,0x13,0x03,0xC0,0x0F,0xC0,0x3F,0xC0,0x73,0x80,0xE7,0x01,0xFC,0x01,0xF0,0x07,0xC0,0x1F,0x9C,0xFF,0xB9,0xE7,0x77,0x07,0xEE,0x0F,0xDC,0x0F,0x3C,0x3E,0x3F,0xFE,0x3F,0xDE,0x3F,0x1C,0x00,0x38,  // &
+			0x00,0x07,0xFF,0xFC,  // '
+			0x00,0x18,0x06,0x1C,0x79,0xE3,0x8E,0x1C,0x38,0xE1,0xC3,0x87,0x0E,0x1C,0x38,0x70,0xE0,0xE1,0xC3,0xC3,0x87,0x87,0x87,  // (
+			0x00,0x18,0xC1,0xC3,0xC3,0xC3,0x83,0x87,0x0E,0x0E,0x1C,0x38,0x70,0xE1,0xC3,0x87,0x0E,0x38,0x71,0xE3,0x9F,0x3C,0x70,  // )
+			0x00,0x09,0x0E,0x01,0xC3,0xBF,0xFF,0xF7,0xFC,0x3F,0x0F,0xE3,0xDE,0x71,0xC0,  // *
+			0x06,0x0A,0x0C,0x03,0x00,0xC0,0x30,0xFF,0xFF,0xF0,0xC0,0x30,0x0C,0x03,0x00,  // +
+			0x10,0x05,0x37,0x6E,0xC0,  // ,
+			0x0B,0x02,0xFF,0xFF,0xC0,  // -
+			0x10,0x03,0xFF,0x80,  // .
+			0x01,0x12,0x00,0x60,0x1C,0x07,0x80,0xE0,0x1C,0x07,0x00,0xE0,0x38,0x0F,0x01,0xC0,0x70,0x0E,0x03,0x80,0xF0,0x1C,0x07,0x80,0xE0,0x1C,0x00,  // /
+			0x01,0x12,0x0F,0x01,0xFC,0x3F,0xE7,0x8E,0x70,0xFE,0x07,0xE0,0x7E,0x07,0xE0,0x7E,0x07,0xE0,0x7E,0x07,0xE0,0x77,0x0E,0x79,0xE7,0xFC,0x3F,0xC0,0xF0,  // 0
+			0x01,0x11,0x1C,0x1E,0x1F,0x1F,0x8F,0xC0,0xE0,0x70,0x38,0x1C,0x0E,0x07,0x03,0x81,0xC0,0xE3,0xFF,0xFF,0xFF,0x80,  // 1
+			0x01,0x11,0x1F,0x07,0xF9,0xFF,0xF8,0xFE,0x0E,0x01,0xC0,0x78,0x1E,0x0F,0x83,0xE1,0xF0,0x38,0x0F,0x01,0xC0,0x3F,0xF7,0xFF,0xFF,0xE0,  // 2
+			0x01,0x12,0x1F,0x07,0xF9,0xFF,0xB8,0x70,0x0E,0x03,0xC7,0xF8,0xFE,0x1F,0x80,0x78,0x07,0x80,0x70,0x0F,0xC1,0xF8,0x7F,0xFE,0x7F,0x83,0xE0,  // 3
+			0x01,0x12,0x00,0xE0,0x03,0x80,0x1E,0x00,0xF8,0x07,0xE0,0x3F,0x81,0xEE,0x0F,0x38,0x38,0xE1,0xFF,0xEF,0xFF,0xDF,0xFE,0x00,0xE0,0x03,0x80,0x0E,0x00,0x38,0x00,0xE0,0x01,0x00,  // 4
+			0x01,0x12,0x7F,0xE7,0xFE,0x7F,0xC6,0x00,0x6F,0x87,0xFC,0xFF,0xEF,0x8F,0xF0,0x7E,0x07,0x00,0x70,0x07,0x00,0x7E,0x0F,0xE1,0xEF,0xFC,0x7F,0x81,0xF0,  // 5
+			0x01,0x12,0x03,0x00,0x78,0x0F,0x01,0xE0,0x3C,0x07,0x80,0x7F,0x87,0xFC,0xFF,0xEF,0x0F,0xE0,0x7E,0x07,0xE0,0x7E,0x07,0x70,0xE7,0xFE,0x3F,0xC1,0xF0,  // 6
+			0x01,0x11,0xFF,0xFF,0xFF,0xFF,0xFC,0x01,0xE0,0x1E,0x01,0xE0,0x0E,0x00,0xF0,0x07,0x00,0x78,0x03,0x80,0x1C,0x01,0xE0,0x0E,0x00,0xF0,0x07,0x00,0x38,0x00,  // 7
+			0x01,0x12,0x0F,0x83,0xFC,0x3F,0xE7,0x0E,0x70,0xE7,0x9E,0x3F,0xC1,0xF8,0x3F,0xE7,0x9E,0xF0,0xFE,0x07,0xE0,0x7E,0x07,0xF0,0xF7,0xFE,0x7F,0xC1,0xF8,  // 8
+			0x01,0x11,0x1F,0x83,0xFC,0x7F,0xEF,0x0F,0xE0,0x7E,0x07,0xE0,0x7F,0x0F,0x7F,0xF3,0xFE,0x1F,0xE0,0x1E,0x03,0xC0,0xF8,0x7F,0x07,0xE0,0x70,0x00,  // 9
+			0x06,0x0C,0xFF,0xF0,0x00,0xFF,0xF0,  // :
+			0x06,0x0F,0x73,0x9C,0xE0,0x00,0x00,0x00,0x0E,0xFF,0x73,0x80,  // ;
+			0x06,0x0A,0x06,0x1C,0x79,0xEF,0x9E,0x1E,0x0E,0x0E,0x0C,  // <
+			0x09,0x06,0xFF,0xFF,0xC0,0x00,0x0F,0xFF,0xFC,  // =
+			0x06,0x0B,0x70,0x3C,0x0F,0x03,0xC0,0xF8,0x3C,0x3C,0x7C,0x7C,0x78,0x38,0x00,  // >
+			0x01,0x11,0x3E,0x0F,0xF3,0xFF,0x71,0xF0,0x0E,0x01,0xC0,0x78,0x1E,0x0F,0x83,0xE0,0xF0,0x1C,0x00,0x00,0x60,0x1C,0x03,0x80,0x60,0x00,  // ?
+			0x00,0x14,0x03,0xF8,0x01,0xFF,0xC0,0x7F,0xFC,0x1F,0x07,0xC7,0x9E,0x3C,0xE7,0xC3,0x9D,0xF0,0x3F,0x39,0x87,0xEE,0x38,0xFD,0xCE,0x1F,0xB9,0xC7,0xF7,0xFF,0xEE,0x7F,0xFD,0xE7,0x1E,0x1C,0x00,0x03,0xC0,0x00,0x3E,0x0F,0x03,0xFF,0xE0,0x3F,0xF8,0x01,0xFC,0x00,  // @
+			0x01,0x12,0x00,0x30,0x00,0xE0,0x03,0xC0,0x07,0x80,0x1F,0x00,0x7F,0x00,0xFE,0x03,0xDC,0x0F,0x38,0x1E,0x70,0x7F,0xF1,0xFF,0xE3,0xFF,0xCF,0x03,0x9C,0x07,0xF8,0x07,0xE0,0x0F,0xC0,0x0C,  // A
+			0x01,0x12,0x7E,0x0F,0xF8,0xFF,0xCE,0x1E,0xE0,0xEE,0x0E,0xE1,0xEF,0xFC,0xFF,0xCF,0xFE,0xE1,0xEE,0x07,0xE0,0x7E,0x0F,0xE3,0xEF,0xFC,0xFF,0x87,0xC0,  // B
+			0x01,0x12,0x01,0xF0,0x3F,0xC3,0xFE,0x3C,0x73,0xC3,0x9C,0x01,0xE0,0x0E,0x00,0xF0,0x07,0x00,0x38,0x01,0xC0,0x0E,0x00,0x70,0x39,0xC3,0xCF,0xFE,0x3F,0xC0,0xF8,0x00,  // C
+			0x01,0x12,0x60,0x03,0xE0,0x0F,0xF0,0x3B,0xF0,0xE3,0xE3,0x83,0xCE,0x07,0xB8,0x0E,0xE0,0x1F,0x80,0x7E,0x01,0xF8,0x07,0xE0,0x3F,0x80,0xEE,0x0F,0xBF,0xFC,0xFF,0xE0,0x7E,0x00,  // D
+			0x01,0x12,0xFF,0xEF,0xFF,0xFF,0xEE,0x00,0xE0,0x0E,0x00,0xE0,0x0F,0xFE,0xFF,0xFF,0xFE,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0F,0xFE,0x7F,0xF3,0xFE,  // E
+			0x01,0x12,0xFF,0xCF,0xFF,0xFF,0xEE,0x00,0xE0,0x0E,0x00,0xFF,0xCF,0xFE,0xFF,0xCE,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x04,0x00,  // F
+			0x01,0x12,0x03,0xC0,0x0F,0xE0,0x3F,0xE0,0xF1,0xC3,0xC0,0x07,0x00,0x1C,0x00,0x38,0x00,0xF1,0xFF,0xCF,0xFF,0xBF,0xF7,0x78,0xEE,0x03,0x9C,0x07,0x3C,0x3C,0x3F,0xF8,0x7F,0xC0,0x3F,0x00,  // G
+			0x01,0x12,0x40,0x05,0xC0,0x1F,0x80,0x3F,0x00,0x7E,0x00,0xFC,0x01,0xF8,0x03,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x3F,0x00,0x7E,0x00,0xFC,0x01,0xF8,0x03,0xF0,0x07,0xE0,0x0E,0x80,0x08,  // H
+			0x01,0x12,0x7F,0xDF,0xFD,0xFF,0x07,0x00,0xE0,0x1C,0x03,0x80,0x70,0x0E,0x01,0xC0,0x38,0x07,0x00,0xE0,0x1C,0x03,0x83,0xFE,0xFF,0xEF,0xF8,  // I
+			0x01,0x12,0x0F,0xFC,0x3F,0xFC,0x3F,0xF0,0x07,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x70,0x00,0xE0,0x01,0xC0,0x03,0x82,0x0F,0x0E,0x1E,0x1C,0x38,0x3E,0x70,0x3F,0xE0,0x3F,0x80,0x1F,0x00,  // J
+			0x01,0x13,0x40,0x4E,0x0E,0xE1,0xEE,0x3C,0xE7,0x8E,0x70,0xEE,0x0F,0xE0,0xFC,0x0F,0x80,0xF8,0x0F,0xC0,0xFE,0x0E,0xF0,0xE7,0x8E,0x3F,0xE1,0xFE,0x07,0x40,0x00,  // K
+			0x01,0x12,0x40,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xE1,0xEF,0xFF,0xFF,0xE7,0xF0,  // L
+			0x01,0x12,0x0C,0x04,0x07,0x03,0x81,0xC0,0xE0,0x78,0x38,0x3E,0x1E,0x0F,0x87,0xC3,0xE1,0xF0,0xFC,0xFC,0x3F,0x3F,0x1D,0xCE,0xC7,0x77,0x31,0xDF,0xCE,0x73,0xF3,0xB8,0xF8,0xEE,0x3E,0x1F,0x87,0x87,0xE1,0xC1,0xF0,0x70,0x30,  // M
+			0x01,0x12,0x60,0x03,0x78,0x01,0xFE,0x00,0xFF,0x00,0x7F,0xC0,0x3F,0xF0,0x1F,0xFC,0x0F,0xDF,0x07,0xE7,0x83,0xF1,0xE1,0xF8,0x78,0xFC,0x1E,0x7E,0x07,0xBF,0x01,0xFF,0x80,0x7F,0xC0,0x1F,0xE0,0x07,0xA0,0x01,0x80,  // N
+			0x01,0x12,0x03,0xF0,0x0F,0xFC,0x1F,0xFE,0x3E,0x1E,0x38,0x0F,0x78,0x07,0x70,0x07,0xF0,0x07,0xE0,0x07,0xE0,0x07,0xE0,0x07,0xE0,0x0E,0xE0,0x0E,0x70,0x1C,0x78,0x3C,0x3F,0xF8,0x1F,0xF0,0x07,0xC0,  // O
+			0x01,0x12,0x7E,0x1F,0xF3,0xFF,0x71,0xFE,0x0F,0xC1,0xF8,0x3F,0x1F,0xFF,0xDF,0xF3,0xF8,0x70,0x0E,0x01,0xC0,0x38,0x07,0x00,0xE0,0x08,0x00,  // P
+			0x01,0x15,0x01,0xFC,0x00,0x7F,0xF0,0x1F,0xFF,0x83,0xE0,0x78,0x7C,0x03,0xC7,0x80,0x1C,0xF0,0x01,0xEE,0x00,0x0E,0xE0,0x00,0xEE,0x00,0x0E,0xE0,0x00,0xEF,0x0E,0x0E,0x70,0xF1,0xC7,0x8F,0xBC,0x3E,0x7F,0x81,0xFF,0xF0,0x0F,0xFF,0x80,0x3F,0x7C,0x00,0x03,0xE0,0x00,0x0F,0x00,0x00,0x70,  // Q
+			0x01,0x12,0x7C,0x07,0xF8,0x3F,0xF1,0xC7,0xCE,0x0E,0x70,0x3B,0x81,0xDC,0x0E,0xE1,0xF7,0xFF,0x3F,0xE1,0xFF,0x0E,0xFC,0x71,0xFB,0x83,0xFC,0x0F,0xE0,0x3A,0x00,0x00,  // R
+			0x01,0x12,0x01,0xF0,0x0F,0xF8,0x3F,0xF0,0xF0,0x03,0x80,0x07,0x00,0x0F,0x00,0x1F,0xF8,0x1F,0xF8,0x0F,0xF8,0x00,0x78,0x00,0x70,0x00,0xFC,0x03,0xFC,0x1F,0x7F,0xFE,0x7F,0xF0,0x3F,0x80,  // S
+			0x01,0x12,0x7F,0xFE,0xFF,0xFF,0x7F,0xFE,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x03,0x80,0x01,0x00,  // T
+			0x01,0x12,0x40,0x05,0xC0,0x1F,0x80,0x3F,0x00,0x7E,0x00,0xFC,0x01,0xF8,0x03,0xF0,0x07,0xE0,0x0F,0xC0,0x1B,0x80,0x77,0x00,0xEF,0x01,0xCE,0x07,0x1E,0x1E,0x1F,0xF8,0x3F,0xE0,0x1F,0x00,  // U
+			0x01,0x12,0xE0,0x1F,0x80,0xFE,0x03,0xFC,0x1E,0x70,0x71,0xC1,0xC7,0x0F,0x0E,0x38,0x38,0xE0,0xE7,0x01,0x9C,0x07,0xF0,0x1F,0x80,0x3E,0x00,0xF0,0x03,0xC0,0x06,0x00,0x18,0x00,  // V
+			0x01,0x12,0xE0,0x60,0x7E,0x0E,0x07,0xE0,0xE0,0xF7,0x0E,0x0E,0x71,0xF0,0xE7,0x1F,0x0E,0x31,0xF1,0xC3,0x3F,0x1C,0x33,0xB1,0xC3,0xBB,0x38,0x1F,0xB3,0x81,0xF3,0xF0,0x1F,0x3F,0x01,0xF3,0xE0,0x0E,0x3E,0x00,0xE1,0xE0,0x0E,0x1C,0x00,0xE1,0xC0,  // W
+			0x01,0x12,0x70,0x06,0x78,0x0F,0x78,0x1F,0x3C,0x1E,0x1E,0x3C,0x0F,0x78,0x07,0xF8,0x03,0xF0,0x03,0xE0,0x03,0xE0,0x07,0xF0,0x0F,0x70,0x1E,0x78,0x3E,0x3C,0x7C,0x1E,0xF8,0x1F,0xF0,0x0F,0xE0,0x07,  // X
+			0x01,0x12,0xE0,0x0F,0xE0,0x1F,0xC0,0x7B,0xC0,0xE3,0xC1,0xC3,0x87,0x07,0x8E,0x07,0xBC,0x07,0xF0,0x0F,0xE0,0x0F,0x80,0x0F,0x00,0x1C,0x00,0x78,0x00,0xE0,0x03,0xC0,0x07,0x00,0x0E,0x00,  // Y
+			0x01,0x12,0x7F,0xFD,0xFF,0xFD,0xFF,0xF0,0x07,0xC0,0x1F,0x00,0x3C,0x00,0xF0,0x03,0xC0,0x07,0x00,0x1E,0x00,0x78,0x00,0xE0,0x03,0xC0,0x07,0x00,0x1C,0x00,0x3F,0xFE,0xFF,0xFE,0xFF,0xF8,  // Z
+			0x00,0x18,0xFF,0xFF,0xF8,0xE3,0x8E,0x38,0xE3,0x8E,0x38,0xE3,0x8E,0x38,0xE3,0x8E,0x38,0xE3,0xFF,0xFF,  // [
+			0x01,0x13,0xE0,0x38,0x0F,0x01,0xC0,0x78,0x0E,0x03,0xC0,0x70,0x1C,0x03,0x80,0xE0,0x3C,0x07,0x01,0xC0,0x38,0x0E,0x03,0xC0,0x70,0x1C,  // 0x5C
+			0x00,0x18,0xFF,0xFF,0xC7,0x1C,0x71,0xC7,0x1C,0x71,0xC7,0x1C,0x71,0xC7,0x1C,0x71,0xC7,0x1F,0xFF,0xFF,  // ]
+			0x00,0x06,0x0E,0x03,0xE0,0xFE,0x3D,0xEF,0x1F,0xC1,0xC0,  // ^
+			0x14,0x02,0xFF,0xFF,0xFF,0xFF,  // _
+			0x00,0x05,0xE3,0xC7,0x8F,0x1C,  // `
+			0x06,0x0D,0x0F,0x07,0xF9,0xFF,0x3C,0xEF,0x1D,0xC3,0xB8,0x77,0x0E,0xE1,0xDE,0x79,0xFF,0xBF,0xF1,0xE6,  // a
+			0x00,0x13,0x40,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x0E,0x00,0xEF,0x8F,0xFC,0xFF,0xEF,0x0E,0xE0,0x7E,0x07,0xE0,0x7E,0x07,0xE0,0xFE,0x1E,0xFF,0xEF,0xFC,0xFF,0x00,  // b
+			0x06,0x0D,0x0F,0x83,0xF8,0xFF,0xBC,0x77,0x01,0xE0,0x38,0x07,0x00,0xE0,0x1E,0x1D,0xFF,0x9F,0xE1,0xF0,  // c
+			0x00,0x13,0x00,0x20,0x07,0x00,0x70,0x07,0x00,0x70,0x07,0x0F,0xF3,0xFF,0x7F,0xF7,0x0F,0xF0,0x7E,0x07,0xE0,0x7E,0x07,0xE0,0x7F,0x0F,0x7F,0xF3,0xFF,0x1F,0xF0,  // d
+			0x06,0x0D,0x0F,0x87,0xF9,0xFF,0xB8,0x7F,0x3F,0xDF,0xBF,0xC7,0xE0,0xF0,0x1E,0x1D,0xFF,0x9F,0xE1,0xF8,  // e
+			0x00,0x15,0x07,0x83,0xF0,0xF8,0x78,0x1C,0x07,0x07,0xFB,0xFF,0x7F,0x87,0x01,0xC0,0x70,0x1C,0x07,0x01,0xC0,0x70,0x1C,0x07,0x01,0xC0,0x70,0x08,0x00,  // f
+			0x06,0x12,0x0F,0x87,0xFD,0xFF,0xBC,0x7F,0x0F,0xC1,0xF8,0x37,0x0E,0xE1,0xDE,0x79,0xFF,0x3F,0xE3,0xDC,0x03,0x80,0xE7,0xFC,0xFF,0x0F,0xC0,  // g
+			0x00,0x13,0x40,0x38,0x0E,0x03,0x80,0xE0,0x38,0x0E,0xFB,0xFF,0xFF,0xFE,0x7F,0x1F,0xC7,0xE1,0xF8,0x7E,0x1F,0x87,0xE1,0xF8,0x74,0x08,  // h
+			0x01,0x12,0xFF,0x80,0xBF,0xFF,0xFF,0xFF,0xE8,  // i
+			0x01,0x17,0x0E,0x0E,0x0E,0x00,0x00,0x04,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0F,0x07,0x07,0x07,0x07,0xC7,0xE7,0xF7,0x7F,0x3E,0x1C,  // j
+			0x00,0x13,0x40,0x1C,0x03,0x80,0x70,0x0E,0x01,0xC0,0x38,0x3F,0x0F,0xE3,0xFC,0xFB,0xFC,0x7F,0x0F,0xF1,0xEF,0x38,0xF7,0x1E,0xE1,0xFC,0x1D,0x01,0x00,  // k
+			0x00,0x13,0x5F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0x00,  // l
+			0x05,0x0F,0x40,0x01,0xCE,0x7B,0xFF,0xFF,0xFF,0xFF,0xBC,0xFE,0x71,0xF8,0xE3,0xF1,0xC7,0xE3,0x8F,0xC7,0x1F,0x8E,0x3F,0x1C,0x7E,0x38,0xE8,0x71,0xC0,0x41,0x00,  // m
+			0x06,0x0D,0xE7,0x3F,0xEF,0xFF,0xE7,0xF1,0xFC,0x7E,0x1F,0x87,0xE1,0xF8,0x7E,0x1F,0x87,0x40,0x80,  // n
+			0x06,0x0D,0x0F,0x07,0xF1,0xFF,0x38,0xFF,0x0F,0xC1,0xF8,0x3F,0x07,0xE0,0xFE,0x39,0xFF,0x1F,0xC1,0xF0,  // o
+			0x06,0x12,0x6F,0x3F,0xEF,0xFB,0xC7,0xE1,0xF8,0x7E,0x1F,0x87,0xE1,0xF8,0xFF,0xFB,0xFC,0xFE,0x38,0x0E,0x03,0x80,0xE0,0x10,0x00,  // p
+			0x06,0x12,0x07,0xE3,0xFC,0xFF,0xBC,0x77,0x0F,0xC1,0xF8,0x3F,0x07,0xE0,0xFE,0x1D,0xFF,0x9F,0xF0,0xFE,0x01,0xC0,0x38,0x07,0x00,0xE0,0x08,  // q
+			0x06,0x0D,0xE7,0xBF,0xFF,0xFF,0xE7,0xF1,0xF8,0x7E,0x03,0x80,0xE0,0x38,0x0E,0x03,0x80,0x40,0x00,  // r
+			0x06,0x0D,0x1F,0xCF,0xF7,0xFD,0xC3,0x78,0x0F,0x81,0xF0,0x1E,0x01,0xF8,0x7F,0xFF,0xFE,0x3E,0x00,  // s
+			0x02,0x11,0x04,0x01,0xC0,0x38,0x07,0x07,0xFD,0xFF,0xDF,0xF0,0x70,0x0E,0x01,0xC0,0x38,0x07,0x00,0xE0,0x1C,0x03,0x80,0x70,0x04,0x00,  // t
+			0x06,0x0D,0x40,0xB8,0x7E,0x1F,0x87,0xE1,0xF8,0x7E,0x1F,0x87,0xE1,0xF8,0x77,0xFD,0xFF,0x3F,0xC0,  // u
+			0x06,0x0D,0xE0,0xFC,0x1F,0xC7,0xB8,0xE7,0x1C,0xF7,0x8E,0xE1,0xDC,0x1F,0x03,0xE0,0x38,0x07,0x00,0xE0,  // v
+			0x06,0x0D,0xE3,0x8F,0xC7,0x1F,0x8E,0x3F,0x3C,0xFE,0x7D,0xDE,0xFB,0x9F,0xF7,0x3F,0xFE,0x7C,0xF8,0xF9,0xF1,0xF3,0xE1,0xC3,0x83,0x87,0x00,  // w
+			0x06,0x0D,0x30,0x77,0x8F,0x3C,0xF1,0xDE,0x1F,0xC0,0xF8,0x0F,0x81,0xF8,0x3F,0xC7,0x9E,0xF0,0xFE,0x0F,0x00,0x70,  // x
+			0x06,0x12,0xE0,0x7F,0x07,0xF0,0xF7,0x8E,0x79,0xE3,0x9C,0x3F,0xC1,0xF8,0x1F,0x80,0xF0,0x0F,0x00,0xE0,0x1E,0x01,0xC0,0x1C,0x03,0xC0,0x38,0x03,0x80,  // y
+			0x06,0x0D,0x7F,0xFF,0xFD,0xFF,0x81,0xE0,0x78,0x1F,0x03,0xC0,0xF8,0x3E,0x0F,0x83,0xFF,0x7F,0xFF,0xFC,  // z
+			0x00,0x16,0x0F,0x0F,0xCF,0xE7,0x03,0x81,0xC0,0xE0,0x70,0x38,0x3C,0x3C,0x1C,0x0F,0x01,0xC0,0xE0,0x70,0x38,0x1C,0x0F,0x03,0xF0,0xF8,0x3C,  // {
+			0x00,0x16,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,  // |
+			0x00,0x16,0x78,0x7E,0x3F,0x81,0xC0,0xE0,0x70,0x38,0x1C,0x0E,0x07,0x81,0xE0,0x70,0x78,0x70,0x38,0x1C,0x0E,0x07,0x07,0x9F,0x8F,0x87,0x80,  // }
+			0x08,0x05,0x1E,0x3B,0xF9,0xDD,0xFF,0xC7,0xEE,0x1E,0x00,  // ~
+			0x01,0x11,0xFF,0xFF,0x00,0x3C,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x3C,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x3C,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x3C,0x00,0xF0,0x03,0xFF,0xFC,  // 0x7F
+};
+
+#endif
@@ -1,7 +1,7 @@
 #ifndef Font12x16_h
 #define Font12x16_h
 
-const uint8_t Font12x16Data[] = {
+const uint8_t Font12x16Data[] PROGMEM = {
 			12,  // Font Width
 			16,  // Font Height
 			32, // Font First Character
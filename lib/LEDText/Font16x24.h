@@ -1,7 +1,7 @@
 #ifndef Font16x24_h
 #define Font16x24_h
 
-const uint8_t Font16x24Data[] = {
+const uint8_t Font16x24Data[] PROGMEM = {
 			16,  // Font Width
 			24,  // Font Height
 			32, // Font First Character
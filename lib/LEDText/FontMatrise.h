@@ -1,7 +1,7 @@
 #ifndef FontMatrise_h
 #define FontMatrise_h
 
-const uint8_t MatriseFontData[] = {  // Modified and improved R Wilson 2022
+const uint8_t MatriseFontData[] PROGMEM = {  // Modified and improved R Wilson 2022
         5,  // Font Width
         7,  // Font Height
         32, // Font First Character
@@ -7,7 +7,7 @@ NOTE: Each character must be defined as maximum width & height
       and the first uint8_t on each line is the actual width
 */
 
-const uint8_t FontP16x16Data[] = {
+const uint8_t FontP16x16Data[] PROGMEM = {
 			FONT_PROPORTIONAL | 16,  // Font Maximum Width
 			16,  // Font Height
 			32, // Font First Character
@@ -0,0 +1,121 @@
+#ifndef FontP16x16Pack_h
+#define FontP16x16Pack_h
+
+// FontP16x16.h packed by the FontPack example, 3172 bytes down to 1462
+const uint8_t FontP16x16PackData[] PROGMEM = {
+			FONT_PROPORTIONAL | 16,  // Font Width
+			FONT_PACKED | 16,  // Font Height
+			32, // Font First Character
+			127,// Font Last Character
+			8,2,7,9,8,13,10,3,4,4,9,9,2,9,2,5,
+			8,5,8,8,8,8,8,8,8,8,2,2,8,8,8,7,
+			14,11,10,10,11,9,9,11,11,2,7,9,9,12,10,11,
+			9,11,10,9,10,10,11,16,11,10,7,4,5,4,7,8,
+			3,8,7,7,7,7,5,7,7,2,3,7,2,12,7,7,
+			7,7,5,7,5,7,8,12,8,8,7,5,2,5,8,5,  // Glyph widths
+			0x00,0x00,0x00,0x00,0x05,0x00,0x0A,0x00,0x1A,0x00,0x28,0x00,0x3E,0x00,0x4F,0x00,0x53,0x00,0x5D,0x00,0x67,0x00,0x74,0x00,0x81,0x00,0x84,0x00,0x88,0x00,0x8B,0x00,
+			0x95,0x00,0xA3,0x00,0xAD,0x00,0xBB,0x00,0xC9,0x00,0xD7,0x00,0xE5,0x00,0xF3,0x00,0x01,0x01,0x0F,0x01,0x1D,0x01,0x21,0x01,0x26,0x01,0x30,0x01,0x36,0x01,0x40,0x01,
+			0x4D,0x01,0x6B,0x01,0x7E,0x01,0x8F,0x01,0xA0,0x01,0xB3,0x01,0xC3,0x01,0xD3,0x01,0xE6,0x01,0xF9,0x01,0xFE,0x01,0x0B,0x02,0x1B,0x02,0x2B,0x02,0x3F,0x02,0x50,0x02,
+			0x63,0x02,0x73,0x02,0x87,0x02,0x98,0x02,0xA8,0x02,0xB9,0x02,0xCA,0x02,0xDD,0x02,0xF7,0x02,0x0A,0x03,0x1B,0x03,0x28,0x03,0x32,0x03,0x3C,0x03,0x46,0x03,0x4C,0x03,
+			0x4F,0x03,0x53,0x03,0x5D,0x03,0x6A,0x03,0x73,0x03,0x80,0x03,0x89,0x03,0x93,0x03,0xA0,0x03,0xAD,0x03,0xB2,0x03,0xBA,0x03,0xC7,0x03,0xCC,0x03,0xDA,0x03,0xE3,0x03,
+			0xEC,0x03,0xF9,0x03,0x06,0x04,0x0D,0x04,0x16,0x04,0x1F,0x04,0x28,0x04,0x32,0x04,0x40,0x04,0x4A,0x04,0x58,0x04,0x61,0x04,0x6D,0x04,0x73,0x04,0x7F,0x04,0x84,0x04,
+			0x90,0x04,  // Glyph offsets
+			  // 0x20
+			0x00,0x0C,0xFF,0xFF,0x0F,  // !
+			0x00,0x03,0x66,0xCF,0x30,  // "
+			0x00,0x0C,0x11,0x08,0x84,0x4F,0xF2,0x21,0x10,0x88,0x44,0xFF,0x22,0x11,0x08,0x80,  // #
+			0x00,0x0C,0x3E,0x6B,0xCB,0xC8,0x68,0x3C,0x16,0x13,0x13,0xD3,0xD6,0x7C,  // $
+			0x00,0x0C,0x78,0x46,0x64,0x33,0x21,0x9A,0x0C,0xD0,0x3D,0x00,0x0B,0xC0,0xB3,0x05,0x98,0x4C,0xC2,0x66,0x21,0xE0,  // %
+			0x00,0x0C,0x3C,0x19,0x86,0x61,0x98,0x3C,0x0E,0x06,0xCF,0x1B,0xC3,0xB0,0x66,0x3C,0xF9,  // &
+			0x00,0x03,0x6F,0x00,  // '
+			0x00,0x10,0x13,0x66,0x4C,0xCC,0xCC,0xC4,0x66,0x31,  // (
+			0x00,0x10,0x8C,0x66,0x23,0x33,0x33,0x32,0x66,0xC8,  // )
+			0x02,0x09,0x08,0x24,0x8A,0x83,0x8F,0xF8,0xE0,0xA8,0x92,0x08,0x00,  // *
+			0x02,0x09,0x08,0x04,0x02,0x01,0x0F,0xF8,0x40,0x20,0x10,0x08,0x00,  // +
+			0x0A,0x04,0xF6,  // ,
+			0x06,0x01,0xFF,0x80,  // -
+			0x0A,0x02,0xF0,  // .
+			0x00,0x0C,0x08,0x44,0x21,0x10,0x88,0x42,0x21,0x00,  // /
+			0x00,0x0C,0x3C,0x66,0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0xC3,0x66,0x3C,  // 0
+			0x00,0x0C,0x19,0xFE,0x31,0x8C,0x63,0x18,0xC6,0x30,  // 1
+			0x00,0x0C,0x3C,0x66,0xC3,0xC3,0x03,0x06,0x0C,0x18,0x30,0x60,0xC0,0xFF,  // 2
+			0x00,0x0C,0x3C,0x66,0xC3,0xC3,0x06,0x1C,0x06,0x03,0xC3,0xC3,0x66,0x3C,  // 3
+			0x00,0x0C,0x06,0x0E,0x0E,0x1E,0x36,0x36,0x66,0xC6,0xFF,0x06,0x06,0x06,  // 4
+			0x00,0x0C,0x7E,0x60,0x60,0xC0,0xFC,0xC6,0x03,0x03,0xC3,0xC3,0x66,0x3C,  // 5
+			0x00,0x0C,0x3C,0x66,0x63,0xC0,0xDC,0xE6,0xC3,0xC3,0xC3,0xC3,0x66,0x3C,  // 6
+			0x00,0x0C,0xFF,0x03,0x06,0x06,0x0C,0x0C,0x0C,0x18,0x18,0x30,0x30,0x30,  // 7
+			0x00,0x0C,0x3C,0x66,0xC3,0xC3,0x66,0x3C,0x66,0xC3,0xC3,0xC3,0x66,0x3C,  // 8
+			0x00,0x0C,0x3C,0x66,0xC3,0xC3,0xC3,0xC3,0x67,0x3B,0x03,0xC6,0x66,0x3C,  // 9
+			0x05,0x07,0xF0,0x3C,  // :
+			0x05,0x09,0xF0,0x3D,0x80,  // ;
+			0x02,0x08,0x03,0x0C,0x30,0xC0,0xC0,0x30,0x0C,0x03,  // <
+			0x04,0x04,0xFF,0x00,0x00,0xFF,  // =
+			0x02,0x08,0xC0,0x30,0x0C,0x03,0x03,0x0C,0x30,0xC0,  // >
+			0x00,0x0C,0x7D,0x8F,0x18,0x30,0x61,0x86,0x0C,0x18,0x00,0x60,0xC0,  // ?
+			0x00,0x10,0x07,0xC0,0x60,0xC2,0x00,0x90,0x02,0x47,0xE6,0x33,0x19,0x8C,0x66,0x31,0x99,0x86,0x66,0x29,0xB9,0x23,0x78,0x40,0x00,0x80,0x01,0x02,0x03,0xF0,  // @
+			0x00,0x0C,0x0E,0x01,0xC0,0x6C,0x0D,0x81,0xB0,0x63,0x0C,0x63,0xFE,0x60,0xCC,0x1B,0x01,0xE0,0x30,  // A
+			0x00,0x0C,0xFE,0x30,0xCC,0x1B,0x06,0xC3,0x3F,0xCC,0x1B,0x03,0xC0,0xF0,0x3C,0x1B,0xFC,  // B
+			0x00,0x0C,0x1F,0x0C,0x66,0x0F,0x03,0xC0,0x30,0x0C,0x03,0x00,0xC0,0xD8,0x33,0x18,0x7C,  // C
+			0x00,0x0C,0xFF,0x18,0x33,0x03,0x60,0x3C,0x07,0x80,0xF0,0x1E,0x03,0xC0,0x78,0x1B,0x06,0x7F,0x80,  // D
+			0x00,0x0C,0xFF,0xE0,0x30,0x18,0x0C,0x07,0xFB,0x01,0x80,0xC0,0x60,0x30,0x1F,0xF0,  // E
+			0x00,0x0C,0xFF,0xE0,0x30,0x18,0x0C,0x07,0xFB,0x01,0x80,0xC0,0x60,0x30,0x18,0x00,  // F
+			0x00,0x0C,0x1F,0x86,0x19,0x81,0xE0,0x3C,0x01,0x80,0x30,0xFE,0x03,0xC0,0x6C,0x0C,0xC3,0x8F,0xB0,  // G
+			0x00,0x0C,0xC0,0x78,0x0F,0x01,0xE0,0x3C,0x07,0xFF,0xF0,0x1E,0x03,0xC0,0x78,0x0F,0x01,0xE0,0x30,  // H
+			0x00,0x0C,0xFF,0xFF,0xFF,  // I
+			0x00,0x0C,0x06,0x0C,0x18,0x30,0x60,0xC1,0x83,0xC7,0x8D,0xB1,0xC0,  // J
+			0x00,0x0C,0xC1,0xE1,0xB1,0x99,0x8D,0x87,0xC3,0xB1,0x98,0xC6,0x61,0xB0,0xD8,0x30,  // K
+			0x00,0x0C,0xC0,0x60,0x30,0x18,0x0C,0x06,0x03,0x01,0x80,0xC0,0x60,0x30,0x1F,0xF0,  // L
+			0x00,0x0C,0xC0,0x3C,0x03,0xE0,0x7E,0x07,0xF0,0xFF,0x0F,0xD9,0xBD,0x9B,0xCF,0x3C,0xF3,0xC6,0x3C,0x63,  // M
+			0x00,0x0C,0xC0,0xF8,0x3F,0x0F,0xC3,0xD8,0xF3,0x3C,0xCF,0x1B,0xC3,0xF0,0xFC,0x1F,0x03,  // N
+			0x00,0x0C,0x1F,0x06,0x31,0x83,0x60,0x3C,0x07,0x80,0xF0,0x1E,0x03,0xC0,0x6C,0x18,0xC6,0x0F,0x80,  // O
+			0x00,0x0C,0xFE,0x61,0xB0,0x78,0x3C,0x1E,0x1B,0xF9,0x80,0xC0,0x60,0x30,0x18,0x00,  // P
+			0x00,0x0D,0x1F,0x06,0x31,0x83,0x60,0x3C,0x07,0x80,0xF0,0x1E,0x03,0xC6,0x6C,0x78,0xC7,0x0F,0xB0,0x02,  // Q
+			0x00,0x0C,0xFF,0x30,0x6C,0x0F,0x03,0xC0,0xF0,0x6F,0xF3,0x06,0xC1,0xB0,0x3C,0x0F,0x03,  // R
+			0x00,0x0C,0x3E,0x31,0xF0,0x78,0x07,0x01,0xF0,0x1C,0x03,0x01,0xE0,0xF8,0xC7,0xC0,  // S
+			0x00,0x0C,0xFF,0xC3,0x00,0xC0,0x30,0x0C,0x03,0x00,0xC0,0x30,0x0C,0x03,0x00,0xC0,0x30,  // T
+			0x00,0x0C,0xC0,0xF0,0x3C,0x0F,0x03,0xC0,0xF0,0x3C,0x0F,0x03,0xC0,0xF0,0x36,0x18,0xFC,  // U
+			0x00,0x0C,0xC0,0x78,0x0D,0x83,0x30,0x66,0x0C,0x63,0x0C,0x60,0xD8,0x1B,0x03,0x60,0x38,0x07,0x00,  // V
+			0x00,0x0C,0xC1,0x83,0xC1,0x83,0xC3,0xC3,0x63,0xC6,0x66,0x66,0x66,0x66,0x36,0x6C,0x3C,0x3C,0x3C,0x3C,0x18,0x18,0x18,0x18,0x18,0x18,  // W
+			0x00,0x0C,0xC0,0x6C,0x18,0xC6,0x18,0xC1,0xB0,0x1C,0x03,0x80,0xD8,0x31,0x86,0x31,0x83,0x60,0x30,  // X
+			0x00,0x0C,0xC0,0xF0,0x36,0x18,0xCC,0x33,0x07,0x80,0xC0,0x30,0x0C,0x03,0x00,0xC0,0x30,  // Y
+			0x00,0x0C,0xFE,0x0C,0x30,0x61,0x83,0x0C,0x18,0x60,0xC3,0x07,0xF0,  // Z
+			0x00,0x10,0xFC,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0xCF,  // [
+			0x00,0x0C,0x84,0x10,0x84,0x10,0x82,0x10,0x82,0x10,  // 0x5C
+			0x00,0x10,0xF3,0x33,0x33,0x33,0x33,0x33,0x33,0x3F,  // ]
+			0x00,0x04,0x10,0x51,0x14,0x10,  // ^
+			0x0F,0x01,0xFF,  // _
+			0x00,0x03,0xD9,0x80,  // `
+			0x04,0x08,0x7C,0xC6,0x06,0x76,0xC6,0xC6,0xC6,0x7B,  // a
+			0x00,0x0C,0xC1,0x83,0x06,0x0F,0xD8,0xF1,0xE3,0xC7,0x8F,0x1F,0xE0,  // b
+			0x04,0x08,0x7D,0x8F,0x1E,0x0C,0x18,0xF1,0xBE,  // c
+			0x00,0x0C,0x06,0x0C,0x18,0x37,0xF8,0xF1,0xE3,0xC7,0x8F,0x1B,0xF0,  // d
+			0x04,0x08,0x7D,0x8F,0x1F,0xFC,0x18,0x71,0xBE,  // e
+			0x00,0x0C,0x3B,0x18,0xCF,0xB1,0x8C,0x63,0x18,0xC0,  // f
+			0x04,0x0C,0x7F,0x8F,0x1E,0x3C,0x78,0xF1,0xBF,0x06,0x0F,0x1B,0xE0,  // g
+			0x00,0x0C,0xC1,0x83,0x06,0x0D,0xDC,0xF1,0xE3,0xC7,0x8F,0x1E,0x30,  // h
+			0x00,0x0C,0xF0,0xFF,0xFF,  // i
+			0x00,0x10,0x6C,0x06,0xDB,0x6D,0xB6,0xDE,  // j
+			0x00,0x0C,0xC1,0x83,0x06,0x0C,0x79,0xB6,0x78,0xD9,0xB3,0x36,0x30,  // k
+			0x00,0x0C,0xFF,0xFF,0xFF,  // l
+			0x04,0x08,0xDC,0xEE,0x73,0xC6,0x3C,0x63,0xC6,0x3C,0x63,0xC6,0x3C,0x63,  // m
+			0x04,0x08,0xDD,0xCF,0x1E,0x3C,0x78,0xF1,0xE3,  // n
+			0x04,0x08,0x7D,0x8F,0x1E,0x3C,0x78,0xF1,0xBE,  // o
+			0x04,0x0C,0xFD,0x8F,0x1E,0x3C,0x78,0xF1,0xFE,0xC1,0x83,0x06,0x00,  // p
+			0x04,0x0C,0x7F,0x8F,0x1E,0x3C,0x78,0xF1,0xBF,0x06,0x0C,0x18,0x30,  // q
+			0x04,0x08,0xDF,0xB1,0x8C,0x63,0x18,  // r
+			0x04,0x08,0x7D,0x8F,0x07,0xC3,0xE0,0xF1,0xBE,  // s
+			0x02,0x0A,0x63,0x3E,0xC6,0x31,0x8C,0x61,0xC0,  // t
+			0x04,0x08,0xC7,0x8F,0x1E,0x3C,0x78,0xF3,0xBB,  // u
+			0x04,0x08,0xC3,0xC3,0x66,0x66,0x3C,0x3C,0x18,0x18,  // v
+			0x04,0x08,0xC6,0x3C,0x63,0x66,0x66,0xF6,0x69,0x63,0x9C,0x30,0xC1,0x08,  // w
+			0x04,0x08,0xC3,0x66,0x3C,0x18,0x18,0x3C,0x66,0xC3,  // x
+			0x04,0x0C,0xC3,0xC3,0x66,0x66,0x3C,0x3C,0x18,0x18,0x18,0x10,0x30,0x60,  // y
+			0x04,0x08,0xFE,0x0C,0x30,0xC3,0x0C,0x30,0x7F,  // z
+			0x00,0x10,0x19,0x8C,0x63,0x19,0x98,0x61,0x8C,0x63,0x18,0xC3,  // {
+			0x00,0x10,0xFF,0xFF,0xFF,0xFF,  // |
+			0x00,0x10,0xC3,0x18,0xC6,0x30,0xC3,0x33,0x18,0xC6,0x31,0x98,  // }
+			0x00,0x03,0x71,0xDB,0x8E,  // ~
+			0x00,0x10,0xFC,0x63,0x18,0xC6,0x31,0x8C,0x63,0x18,0xC6,0x3F,  // 0x7F
+};
+
+#endif
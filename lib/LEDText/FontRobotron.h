@@ -1,7 +1,7 @@
 #ifndef FontRobotron_h
 #define FontRobotron_h
 
-const uint8_t RobotronFontData[] = {
+const uint8_t RobotronFontData[] PROGMEM = {
 					7,		// Font Width
 					7,		// Font Height
 					32,		// Font First Character
@@ -13,11 +13,6 @@ Even the basic examples need 12k rom & 4k ram
 #include <LEDMatrix.h>
 #include <LEDText.h>
 
-#define  BACKGND_MASK    (BACKGND_ERASE | BACKGND_LEAVE | BACKGND_DIMMING)
-#define  CHAR_MASK       (CHAR_UP | CHAR_DOWN | CHAR_LEFT | CHAR_RIGHT)
-#define  SCROLL_MASK     (SCROLL_LEFT | SCROLL_RIGHT | SCROLL_UP | SCROLL_DOWN)
-#define  COLR_MASK       (COLR_RGB | COLR_HSV | COLR_SINGLE | COLR_GRAD | COLR_CHAR | COLR_AREA | COLR_VERT | COLR_HORI | COLR_EMPTY | COLR_DIMMING)
-
 #define  UC_CHAR_UP            0xd8
 #define  UC_CHAR_DOWN          0xd9
 #define  UC_CHAR_LEFT          0xda
@@ -49,27 +44,216 @@ Even the basic examples need 12k rom & 4k ram
 #define  UC_DELAY_FRAMES       0xf9
 #define  UC_CUSTOM_RC          0xfa
 
+cLEDText::~cLEDText()
+{
+  if (m_Code != NULL)
+    free(m_Code);
+  if (m_GlyphSlot != NULL)
+    free(m_GlyphSlot);
+  if (m_ColrTable != NULL)
+    free(m_ColrTable);
+  if (m_FontSlot != NULL)
+    free(m_FontSlot);
+  if (m_Window != NULL)
+    free(m_Window);
+}
+
 
 void cLEDText::SetFont(const uint8_t *FontData)
 {
-  m_FontHeight = FontData[1];
-  m_FontBase = FontData[2];
-  m_FontUpper = FontData[3];
-  m_FontData = &FontData[4];
-  if ((FontData[0] & FONT_PROPORTIONAL) == FONT_PROPORTIONAL)
+  uint8_t fw = pgm_read_byte(&FontData[0]);
+  uint8_t fh = pgm_read_byte(&FontData[1]);
+
+  m_FontHeight = fh & 0x3f;
+  m_FPacked = ((fh & FONT_PACKED) == FONT_PACKED);
+  m_FSparse = ((fh & FONT_SPARSE) == FONT_SPARSE);
+  m_FontBase = pgm_read_byte(&FontData[2]);
+  m_FontUpper = pgm_read_byte(&FontData[3]);
+  if (m_FSparse)
+  { // Sparse: [glyph count - 1] [sorted characters, one per glyph] then the glyphs as usual
+    m_FGlyphs = pgm_read_byte(&FontData[4]) + 1;
+    m_FChars = &FontData[5];
+    m_FontData = &FontData[5 + m_FGlyphs];
+  }
+  else
   {
-    m_FontWidth = FontData[0] & 0x7f;
+    m_FGlyphs = (m_FontUpper - m_FontBase) + 1;
+    m_FChars = NULL;
+    m_FontData = &FontData[4];
+  }
+  m_FLastCh = 0xffff;
+  if ((fw & FONT_PROPORTIONAL) == FONT_PROPORTIONAL)
+  {
+    m_FontWidth = fw & 0x7f;
     m_FCBytes = 1;
     m_FProp = true;
   }
   else
   {
-    m_FontWidth = FontData[0];
+    m_FontWidth = fw;
     m_FCBytes = 0;
     m_FProp = false;
   }
   m_FWBytes = (m_FontWidth + 7) / 8;
   m_FCBytes += (m_FWBytes * m_FontHeight);
+  // Packed: [widths if proportional] [glyph count + 1 stream offsets] [glyph streams]
+  m_FIndex = m_FProp ? m_FGlyphs : 0;
+  m_FStream = m_FIndex + ((m_FGlyphs + 1) * 2);
+  AllocFontGlyphs();
+  if (m_Code != NULL)
+    CompileText();
+  if (m_GlyphSlots > 0)
+    AllocGlyphCache();
+}
+
+
+// Flash a byte at a time through whole aligned words, the ESP8266 faults on byte reads from flash.
+// Little endian like every target.
+struct cFlashStream
+{
+  uintptr_t a;
+  uint32_t w;
+  uint8_t b;
+
+  cFlashStream(const uint8_t *Src) : a((uintptr_t)Src & ~(uintptr_t)3), b((uintptr_t)Src & 3)
+  {
+    w = pgm_read_dword((const uint32_t *)a);
+  }
+  inline uint8_t Next()
+  {
+    if (b == 4)
+    {
+      a += 4;
+      w = pgm_read_dword((const uint32_t *)a);
+      b = 0;
+    }
+    return(w >> (8 * b++));
+  }
+};
+
+
+void cLEDText::FontRead(uint16_t Offset, uint8_t *Dst, uint16_t Len)
+{
+  cFlashStream fs(&m_FontData[Offset]);
+
+  while (Len-- > 0)
+    *Dst++ = fs.Next();
+}
+
+
+bool cLEDText::AllocFontGlyphs()
+{
+  uint16_t size = m_FWBytes * m_FontHeight, bytes;
+
+  m_FontSlots = m_FPacked ? FONT_PACKED_GLYPHS : FONT_PLAIN_GLYPHS;
+  bytes = (m_FontSlots * sizeof(cGlyphSlot)) + (m_FontSlots * size);
+  // The block is only replaced when the new font needs more than it holds
+  if ( (m_FontSlot == NULL) || (m_FontSlotBytes < bytes) )
+  {
+    if (m_FontSlot != NULL)
+      free(m_FontSlot);
+    m_FontSlotBytes = 0;
+    if ((m_FontSlot = (cGlyphSlot *)malloc(bytes)) == NULL)
+      return(false);
+    m_FontSlotBytes = bytes;
+  }
+  m_FontGlyph = (uint8_t *)&m_FontSlot[m_FontSlots];
+  for (uint8_t i=0; i<m_FontSlots; ++i)
+    m_FontSlot[i].Key = GLYPH_EMPTY;
+  m_FontLast = 0;
+  m_FontClock = 0;
+  return(true);
+}
+
+
+const uint8_t *cLEDText::FetchGlyph(uint8_t Ch)
+{
+  uint16_t size = m_FWBytes * m_FontHeight;
+  uint8_t i, oldest = 0;
+
+  if (m_FontSlot == NULL)
+    return(NULL);
+  ++m_FontClock;
+  for (i=0; i<m_FontSlots; ++i)
+  {
+    if (m_FontSlot[i].Key == Ch)
+    {
+      m_FontSlot[i].Used = m_FontClock;
+      m_FontLast = i;
+      return(&m_FontGlyph[i * size]);
+    }
+    if ((uint16_t)(m_FontClock - m_FontSlot[i].Used) > (uint16_t)(m_FontClock - m_FontSlot[oldest].Used))
+      oldest = i;
+    if (m_FontSlot[i].Key == GLYPH_EMPTY)
+    {
+      oldest = i;
+      break;
+    }
+  }
+  m_FontSlot[oldest].Key = Ch;
+  m_FontSlot[oldest].Used = m_FontClock;
+  m_FontLast = oldest;
+  uint8_t *g = &m_FontGlyph[oldest * size];
+  if (m_FPacked)
+    UnpackGlyph(Ch, g);
+  else
+    FontRead((GlyphIndex(Ch) * m_FCBytes) + (m_FProp ? 1 : 0), g, size);
+  return(g);
+}
+
+
+void cLEDText::UnpackGlyph(uint8_t Ch, uint8_t *Dst)
+{
+  // Glyph stream: first row, row count, then the rows at the glyph width as one MSB first bit string.
+  // Blank rows above and below are left out, a blank glyph has no stream at all.
+  uint16_t size = m_FWBytes * m_FontHeight;
+  uint8_t ofs[4], fw, top, rows, nb = 0;
+  uint32_t acc = 0;
+
+  memset(Dst, 0x00, size);
+  FontRead(m_FIndex + (GlyphIndex(Ch) * 2), ofs, sizeof(ofs));
+  if ((ofs[0] | (ofs[1] << 8)) == (ofs[2] | (ofs[3] << 8)))
+    return;
+  cFlashStream fs(&m_FontData[m_FStream + (ofs[0] | (ofs[1] << 8))]);
+  fw = m_FProp ? GlyphWidth(Ch) : m_FontWidth;
+  top = fs.Next();
+  rows = fs.Next();
+  for (uint8_t *row=&Dst[top * m_FWBytes]; rows>0; --rows, row+=m_FWBytes)
+  {
+    for (uint8_t x=0; x<fw; x+=8)
+    {
+      uint8_t bits = min(fw - x, 8);
+      if (nb < bits)
+      {
+        acc |= (uint32_t)fs.Next() << (24 - nb);
+        nb += 8;
+      }
+      row[x / 8] = (acc >> 24) & (0xff00 >> bits);
+      acc <<= bits;
+      nb -= bits;
+    }
+  }
+}
+
+
+int16_t cLEDText::SparseIndex(uint8_t Ch)
+{
+  // Characters the font leaves out get glyph 0
+  uint16_t lo = 0, hi = m_FGlyphs;
+
+  while (lo < hi)
+  {
+    uint16_t mid = (lo + hi) / 2;
+    if (pgm_read_byte(&m_FChars[mid]) < Ch)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if ((lo >= m_FGlyphs) || (pgm_read_byte(&m_FChars[lo]) != Ch))
+    lo = 0;
+  m_FLastCh = Ch;
+  m_FLastGlyph = lo;
+  return(lo);
 }
 
 
@@ -84,12 +268,15 @@ void cLEDText::Init(cLEDMatrixBase *Matrix, uint16_t Width, uint16_t Height, int
   m_Col1[0] = m_Col1[1] = m_Col1[2] = 255;
   m_LastDelayTP = m_LastCustomRCTP = m_DelayCounter = 0;
   m_FrameRate = 0;
-  Initialised = true;
+  m_ShiftSafe = false;
+  m_ColrCount = 0;
+  Initialised = m_Redraw = true;
 }
 
 
 void cLEDText::SetBackgroundMode(uint16_t Options, uint8_t Dimming)
 {
+  m_Redraw = true;
   m_Options = (m_Options & (~BACKGND_MASK)) | (Options & BACKGND_MASK);
   if ((m_Options & BACKGND_MASK) == BACKGND_DIMMING)
     m_BackDim = Dimming;
@@ -98,19 +285,22 @@ void cLEDText::SetBackgroundMode(uint16_t Options, uint8_t Dimming)
 
 void cLEDText::SetScrollDirection(uint16_t Options)
 {
+  m_Redraw = true;
   m_Options = (m_Options & (~SCROLL_MASK)) | (Options & SCROLL_MASK);
 }
 
 
 void cLEDText::SetTextDirection(uint16_t Options)
 {
+  m_Redraw = true;
   m_Options = (m_Options & (~CHAR_MASK)) | (Options & CHAR_MASK);
 }
 
 
 void cLEDText::SetTextColrOptions(uint16_t Options, uint8_t ColA1, uint8_t ColA2, uint8_t ColA3, uint8_t ColB1, uint8_t ColB2, uint8_t ColB3)
 {
-  m_Options = (m_Options & (~COLR_MASK)) | (Options & COLR_MASK);
+  m_Redraw = true;
+  m_Options = (m_Options & (~(COLR_MASK | COLR_INDEX))) | (Options & (COLR_MASK | COLR_INDEX));
   if ((m_Options & COLR_EMPTY) != COLR_EMPTY)
   {
     if ((m_Options & COLR_DIMMING) == COLR_DIMMING)
@@ -143,13 +333,212 @@ void cLEDText::SetOptionsChangeMode(uint16_t Options)
 }
 
 
-void cLEDText::SetText(unsigned char *Txt, uint16_t TxtSize)
+void cLEDText::SetText(const unsigned char *Txt, uint16_t TxtSize, bool Compile)
 {
+  if (m_Window != NULL)
+  {
+    free(m_Window);
+    m_Window = NULL;
+  }
+  m_Source = m_NextSource = NULL;
   m_pText = Txt;
   m_pSize = TxtSize;
+  if (m_Code != NULL)
+  {
+    free(m_Code);
+    m_Code = NULL;
+  }
+  if ((Compile) && (TxtSize > 0))
+  {
+    // Without the memory the text is just decoded every frame as before
+    m_Code = (cTextCode *)malloc(TxtSize * sizeof(cTextCode));
+    if (m_Code != NULL)
+      CompileText();
+  }
   m_TextPos = m_EOLtp = m_XBitPos = m_YBitPos = 0;
   m_LastDelayTP = m_LastCustomRCTP = 0;
-  Initialised = true;
+  Initialised = m_Redraw = true;
+}
+
+
+bool cLEDText::SetSource(cTextSource *Source, uint16_t Lookahead)
+{
+  if (m_Code != NULL)
+  {
+    free(m_Code);
+    m_Code = NULL;
+  }
+  // Lookahead is only the starting size, MoreText() grows the window when a frame needs more text.
+  // A window that has grown is kept for the next source.
+  if ( (m_Window != NULL) && (m_WinSize < Lookahead) )
+  {
+    free(m_Window);
+    m_Window = NULL;
+  }
+  if (m_Window == NULL)
+  {
+    m_Window = (unsigned char *)malloc(Lookahead);
+    m_WinSize = Lookahead;
+  }
+  m_Source = (m_Window != NULL) ? Source : NULL;
+  m_NextSource = NULL;
+  m_pText = m_Window;
+  m_pSize = m_WinFill = 0;
+  m_SourceEnd = false;
+  m_TextPos = m_EOLtp = m_XBitPos = m_YBitPos = 0;
+  m_LastDelayTP = m_LastCustomRCTP = 0;
+  Initialised = m_Redraw = true;
+  return(m_Source != NULL);
+}
+
+
+bool cLEDText::QueueSource(cTextSource *Next)
+{
+  if (m_Source == NULL)
+    return(false);
+  // Only ever read from FillText(), so the switch is at the boundary between the two texts and
+  // the caller can build Next, or queue another in its place, until then without tearing
+  if ( (m_SourceEnd) && (Next != NULL) )
+  {
+    m_Source = Next;
+    m_SourceEnd = false;
+  }
+  else
+    m_NextSource = Next;
+  return(true);
+}
+
+
+// Argument bytes that follow an effect code
+static uint8_t CodeArgs(uint8_t Ch)
+{
+  switch (Ch)
+  {
+    case UC_BACKGND_DIMMING:
+    case UC_FRAME_RATE:
+    case UC_CUSTOM_RC:
+    case UC_COLR_DIMMING:
+      return(1);
+    case UC_DELAY_FRAMES:
+      return(2);
+    case UC_RGB:
+    case UC_HSV:
+    case UC_RGB_CV:
+    case UC_HSV_CV:
+    case UC_RGB_AV:
+    case UC_HSV_AV:
+    case UC_RGB_CH:
+    case UC_HSV_CH:
+    case UC_RGB_AH:
+    case UC_HSV_AH:
+      return(((((uint16_t)Ch & 0x0f) << 6) & COLR_GRAD) ? 6 : 3);
+  }
+  return(0);
+}
+
+
+void cLEDText::FillText()
+{
+  uint16_t d, tp;
+
+  // Drops what has scrolled past, the positions the renderer keeps move with the text. Three bytes
+  // stay before m_TextPos, so a delay code that has gone (now at 0) never looks like the one just decoded.
+  d = (m_TextPos > 3) ? (m_TextPos - 3) : 0;
+  if (d > 0)
+  {
+    memmove(m_Window, &m_Window[d], m_WinFill - d);
+    m_WinFill -= d;
+    m_TextPos -= d;
+    m_EOLtp = (m_EOLtp > d) ? (m_EOLtp - d) : 0;
+    m_LastDelayTP = (m_LastDelayTP > d) ? (m_LastDelayTP - d) : 0;
+    m_LastCustomRCTP = (m_LastCustomRCTP > d) ? (m_LastCustomRCTP - d) : 0;
+  }
+  else if ( (m_SourceEnd) || (m_WinFill == m_WinSize) )
+    return;
+  while ( (!m_SourceEnd) && (m_WinFill < m_WinSize) )
+  {
+    tp = m_Source->Read(&m_Window[m_WinFill], m_WinSize - m_WinFill);
+    if ( (tp == 0) && (m_NextSource != NULL) )
+    {
+      m_Source = m_NextSource;
+      m_NextSource = NULL;
+    }
+    else if (tp == 0)
+      m_SourceEnd = true;
+    m_WinFill += tp;
+  }
+  // The renderer only sees whole codes, the arguments of the last one may still be to come
+  if (m_SourceEnd)
+    m_pSize = m_WinFill;
+  else
+  {
+    for (tp=0; tp<m_WinFill; )
+    {
+      uint8_t ch = m_Window[tp];
+      uint16_t next = tp + 1;
+      if ((ch < m_FontBase) || (ch > m_FontUpper))
+        next += CodeArgs(ch);
+      if (next > m_WinFill)
+        break;
+      tp = next;
+    }
+    m_pSize = tp;
+  }
+}
+
+
+// Reads on when the renderer is at the end of the lookahead, growing it if it is already full.
+// False once the source has ended, or if the lookahead is at TEXT_WINDOW_MAX or there is no memory
+// to grow it, the window is then left as it was.
+bool cLEDText::MoreText()
+{
+  uint16_t Left = m_pSize - m_TextPos, Size;
+  unsigned char *Window;
+
+  while ( (m_Source != NULL) && (!m_SourceEnd) )
+  {
+    FillText();
+    if ((m_pSize - m_TextPos) > Left)
+      return(true);
+    if ( (m_SourceEnd) || (m_WinSize >= TEXT_WINDOW_MAX) )
+      break;
+    Size = (uint16_t)min((uint32_t)m_WinSize + max(m_WinSize, (uint16_t)8), (uint32_t)TEXT_WINDOW_MAX);
+    if ((Window = (unsigned char *)realloc(m_Window, Size)) == NULL)
+      break;
+    m_pText = m_Window = Window;
+    m_WinSize = Size;
+  }
+  return(false);
+}
+
+
+bool cTextSegments::Add(const unsigned char *Data, uint16_t Len)
+{
+  if (m_Segments >= TEXT_SEGMENTS_MAX)
+    return(false);
+  m_Data[m_Segments] = Data;
+  m_Len[m_Segments++] = Len;
+  return(true);
+}
+
+
+uint16_t cTextSegments::Read(unsigned char *Dst, uint16_t Len)
+{
+  uint16_t n = 0, c;
+
+  while ( (n < Len) && (m_Seg < m_Segments) )
+  {
+    c = min((uint16_t)(Len - n), (uint16_t)(m_Len[m_Seg] - m_Ofs));
+    memcpy(&Dst[n], &m_Data[m_Seg][m_Ofs], c);
+    n += c;
+    m_Ofs += c;
+    if (m_Ofs >= m_Len[m_Seg])
+    {
+      ++m_Seg;
+      m_Ofs = 0;
+    }
+  }
+  return(n);
 }
 
 
@@ -235,17 +624,350 @@ void cLEDText::DecodeOptions(uint16_t *tp, uint16_t *opt, uint8_t *backDim, uint
 }
 
 
-int cLEDText::UpdateText()
+void cLEDText::CompileText()
 {
-  uint8_t bDim, cDim, c1[3], c2[3], xbp, RC;
-  int16_t x, y, MinY, MaxY;
-  uint16_t opt, tp, MfractAV, MfractAH;
+  for (uint16_t tp=0; tp<m_pSize; ++tp)
+  {
+    cTextCode *c = &m_Code[tp];
+    uint8_t ch = m_pText[tp];
+    c->Mask = 0;
+    c->Args = 0;
+    if ((ch >= m_FontBase) && (ch <= m_FontUpper))
+    {
+      uint16_t fdo = GlyphIndex(ch) * m_FCBytes;
+      if (m_FProp == true)
+      {
+        c->Width = GlyphWidth(ch);
+        ++fdo;
+      }
+      else
+        c->Width = m_FontWidth;
+      c->Data = fdo;
+      continue;
+    }
+    c->Data = c->Width = 0;
+    switch (ch)
+    {
+      case UC_BACKGND_ERASE:
+      case UC_BACKGND_LEAVE:
+      case UC_BACKGND_DIMMING:
+        c->Mask = BACKGND_MASK;
+        c->Data = (uint16_t)ch & BACKGND_MASK;
+        c->Args = (ch == UC_BACKGND_DIMMING) ? 1 : 0;
+        break;
+      case UC_FRAME_RATE:
+      case UC_DELAY_FRAMES:
+      case UC_CUSTOM_RC:
+        // These depend on where the renderer has been before
+        c->Args = TEXTCODE_DECODE;
+        break;
+      case UC_CHAR_UP:
+      case UC_CHAR_DOWN:
+      case UC_CHAR_LEFT:
+      case UC_CHAR_RIGHT:
+        c->Mask = CHAR_MASK;
+        c->Data = (((uint16_t)ch & 0x03) << 2) & CHAR_MASK;
+        break;
+      case UC_SCROLL_LEFT:
+      case UC_SCROLL_RIGHT:
+      case UC_SCROLL_UP:
+      case UC_SCROLL_DOWN:
+        c->Mask = SCROLL_MASK;
+        c->Data = (((uint16_t)ch & 0x03) << 4) & SCROLL_MASK;
+        break;
+      case UC_RGB:
+      case UC_HSV:
+      case UC_RGB_CV:
+      case UC_HSV_CV:
+      case UC_RGB_AV:
+      case UC_HSV_AV:
+      case UC_RGB_CH:
+      case UC_HSV_CH:
+      case UC_RGB_AH:
+      case UC_HSV_AH:
+        c->Mask = COLR_MASK;
+        c->Data = (((uint16_t)ch & 0x0f) << 6) & COLR_MASK;
+        c->Args = ((c->Data & COLR_GRAD) == COLR_GRAD) ? 6 : 3;
+        break;
+      case UC_COLR_EMPTY:
+        c->Mask = COLR_MASK;
+        c->Data = COLR_EMPTY;
+        break;
+      case UC_COLR_DIMMING:
+        c->Mask = COLR_MASK;
+        c->Data = COLR_DIMMING;
+        c->Args = 1;
+        break;
+    }
+  }
+}
 
-  RC = 0;
-  if (m_TextPos >= m_pSize)
-    return(-1);
-  MfractAV = 65535 / ((m_YMax - m_YMin) + 1);
-  MfractAH = 65535 / ((m_XMax - m_XMin) + 1);
+
+bool cLEDText::SetGlyphCache(uint8_t Glyphs)
+{
+  m_GlyphSlots = Glyphs;
+  if (m_FontData == NULL)
+    return(Glyphs == 0);  // Allocated by SetFont()
+  return(AllocGlyphCache());
+}
+
+
+bool cLEDText::AllocGlyphCache()
+{
+  if (m_GlyphSlot != NULL)
+  {
+    free(m_GlyphSlot);
+    m_GlyphSlot = NULL;
+    m_GlyphBits = NULL;
+  }
+  // One column per step along the glyph plus the gap, each column must fit the mask
+  m_GlyphCols = max(m_FontWidth, m_FontHeight) + 1;
+  if ( (m_GlyphSlots == 0) || (m_GlyphCols > GLYPH_MAX_BITS) )
+    return(false);
+  m_GlyphSlot = (cGlyphSlot *)malloc((m_GlyphSlots * sizeof(cGlyphSlot)) + (m_GlyphSlots * m_GlyphCols * sizeof(uint32_t)));
+  if (m_GlyphSlot == NULL)
+    return(false);
+  m_GlyphBits = (uint32_t *)&m_GlyphSlot[m_GlyphSlots];
+  for (uint8_t i=0; i<m_GlyphSlots; ++i)
+    m_GlyphSlot[i].Key = GLYPH_EMPTY;
+  m_GlyphClock = 0;
+  return(true);
+}
+
+
+const uint32_t *cLEDText::GlyphColumns(uint8_t Ch, uint16_t Opt)
+{
+  uint16_t key = Ch | ((Opt & (CHAR_MASK | SCROLL_MASK)) << 6);
+  uint8_t i, oldest = 0;
+
+  ++m_GlyphClock;
+  for (i=0; i<m_GlyphSlots; ++i)
+  {
+    if (m_GlyphSlot[i].Key == key)
+    {
+      m_GlyphSlot[i].Used = m_GlyphClock;
+      return(&m_GlyphBits[i * m_GlyphCols]);
+    }
+    if ((uint16_t)(m_GlyphClock - m_GlyphSlot[i].Used) > (uint16_t)(m_GlyphClock - m_GlyphSlot[oldest].Used))
+      oldest = i;
+    if (m_GlyphSlot[i].Key == GLYPH_EMPTY)
+    {
+      oldest = i;
+      break;
+    }
+  }
+  m_GlyphSlot[oldest].Key = key;
+  m_GlyphSlot[oldest].Used = m_GlyphClock;
+  uint32_t *cols = &m_GlyphBits[oldest * m_GlyphCols];
+  uint16_t base = GlyphIndex(Ch) * m_FCBytes;
+  uint8_t fw, rows, xbpmax, xgap;
+  if (m_FProp == true)
+  {
+    fw = GlyphWidth(Ch);
+    ++base;
+  }
+  else
+    fw = m_FontWidth;
+  if ( ((Opt & CHAR_MASK) == CHAR_UP) || ((Opt & CHAR_MASK) == CHAR_DOWN) )
+  {
+    rows = m_FontHeight;
+    xbpmax = fw;
+  }
+  else
+  {
+    rows = fw;
+    xbpmax = m_FontHeight;
+  }
+  xgap = ((Opt & SCROLL_MASK) == SCROLL_RIGHT) ? 0 : xbpmax;
+  const uint8_t *gb = FontGlyph(Ch);
+  if (gb != NULL)
+    base = 0;
+  // Bit n of a column is the pixel n rows below the top of the glyph, as the renderer walks it
+  for (uint8_t xbp=0; xbp<=xbpmax; ++xbp)
+  {
+    uint32_t bits = 0;
+    if (xbp != xgap)
+    {
+      uint16_t fdo = base;
+      uint8_t bf;
+      GlyphBitStart(Opt, fw, xbp, &fdo, &bf);
+      for (uint8_t n=0; n<rows; ++n)
+      {
+        if ((GlyphByte(gb, fdo) & bf) != 0x00)
+          bits |= (uint32_t)1 << n;
+        GlyphBitStep(Opt, &fdo, &bf);
+      }
+    }
+    cols[xbp] = bits;
+  }
+  return(cols);
+}
+
+
+void cLEDText::SetIncremental(bool Incremental)
+{
+  m_Redraw = true;
+  m_Incremental = Incremental;
+}
+
+
+void cLEDText::SetColrTable(bool Enable)
+{
+  if (m_ColrTable != NULL)
+  {
+    free(m_ColrTable);
+    m_ColrTable = NULL;
+  }
+  m_ColrSize = m_ColrCount = 0;
+  m_ColrTab = Enable;  // Allocated by the first ColrTable() call
+}
+
+
+const struct CRGB *cLEDText::ColrTable(uint16_t Opt, const uint8_t *Col1, const uint8_t *Col2, uint8_t Rows, uint8_t XbpMax, int16_t Width, int16_t Height)
+{
+  int16_t count;
+  uint16_t fmul = 0;
+  int16_t fofs = 0;
+
+  Opt &= COLR_MASK;
+  // Same fractions as the per pixel code, entry i is row/column i of the glyph or matrix
+  if ((Opt & COLR_GRAD) == COLR_SINGLE)
+    count = 1;
+  else if ((Opt & (COLR_AREA | COLR_HORI)) == (COLR_CHAR | COLR_VERT))
+  {
+    count = Rows;
+    fmul = 65535 / Rows;
+  }
+  else if ((Opt & (COLR_AREA | COLR_HORI)) == (COLR_AREA | COLR_VERT))
+  {
+    count = Height;
+    fmul = 65535 / ((m_YMax - m_YMin) + 1);
+    fofs = m_YMin;
+  }
+  else if ((Opt & (COLR_AREA | COLR_HORI)) == (COLR_CHAR | COLR_HORI))
+  {
+    count = XbpMax + 1;
+    fmul = 65535 / XbpMax;
+  }
+  else
+  {
+    count = Width;
+    fmul = 65535 / ((m_XMax - m_XMin) + 1);
+    fofs = m_XMin;
+  }
+  if ( (count == m_ColrCount) && (Opt == m_ColrOpt) && (memcmp(m_ColrKey, Col1, 3) == 0) && (memcmp(&m_ColrKey[3], Col2, 3) == 0) )
+    return(m_ColrTable);
+  if (count > m_ColrSize)
+  {
+    if (m_ColrTable != NULL)
+      free(m_ColrTable);
+    m_ColrTable = (struct CRGB *)malloc(count * sizeof(struct CRGB));
+    if (m_ColrTable == NULL)
+    {
+      m_ColrSize = m_ColrCount = 0;
+      return(NULL);
+    }
+    m_ColrSize = count;
+  }
+  for (int16_t i=0; i<count; ++i)
+  {
+    uint8_t v[3];
+    if ((Opt & COLR_GRAD) == COLR_SINGLE)
+      memcpy(v, Col1, sizeof(v));
+    else
+      GradColr((i - fofs) * fmul, Col1, Col2, v);
+    if ((Opt & COLR_HSV) == COLR_RGB)
+      m_ColrTable[i] = CRGB(v[0], v[1], v[2]);
+    else
+      m_ColrTable[i] = CHSV(v[0], v[1], v[2]);
+  }
+  m_ColrCount = count;
+  m_ColrOpt = Opt;
+  memcpy(m_ColrKey, Col1, 3);
+  memcpy(&m_ColrKey[3], Col2, 3);
+  return(m_ColrTable);
+}
+
+
+bool cLEDText::ShiftSafe(uint16_t Opt)
+{
+  // Pixels that depend on what was under them or on where they are in the window cannot be moved
+  if ( ((Opt & BACKGND_MASK) != BACKGND_ERASE) || ((Opt & COLR_MASK) == COLR_EMPTY) || ((Opt & COLR_MASK) == COLR_DIMMING) )
+    return(false);
+  if ((Opt & (COLR_GRAD | COLR_AREA)) == (COLR_GRAD | COLR_AREA))
+  {
+    if ( ((Opt & SCROLL_MASK) == SCROLL_LEFT) || ((Opt & SCROLL_MASK) == SCROLL_RIGHT) )
+      return((Opt & COLR_HORI) != COLR_HORI);
+    return((Opt & COLR_HORI) == COLR_HORI);
+  }
+  return(true);
+}
+
+
+bool cLEDText::ShiftArea(int16_t Width, int16_t Height, int16_t &x0, int16_t &y0, int16_t &x1, int16_t &y1)
+{
+  // The pixels the last frame wrote, clipped to the matrix
+  x0 = max(m_XMin, (int16_t)0);
+  x1 = min(m_XMax, (int16_t)(Width - 1));
+  if ( ((m_Options & SCROLL_MASK) == SCROLL_LEFT) || ((m_Options & SCROLL_MASK) == SCROLL_RIGHT) )
+  {
+    y0 = max((int16_t)(m_YMax - m_ShiftRows - 1), (int16_t)0);
+    y1 = min(m_YMax, (int16_t)(Height - 1));
+  }
+  else
+  { // Lines run past the window edges, only possible if those are off the matrix
+    if ( (m_YMin > 0) || (m_YMax < (Height - 1)) )
+      return(false);
+    y0 = 0;
+    y1 = Height - 1;
+  }
+  return((x0 < x1) && (y0 < y1));
+}
+
+
+void cLEDText::DecodeCode(uint16_t *tp, uint16_t *opt, uint8_t *backDim, uint8_t *col1, uint8_t *col2, uint8_t *colDim, uint8_t *RC)
+{
+  if ((m_Code == NULL) || (m_Code[*tp].Args == TEXTCODE_DECODE))
+  {
+    DecodeOptions(tp, opt, backDim, col1, col2, colDim, RC);
+    return;
+  }
+  const cTextCode *c = &m_Code[*tp];
+  const unsigned char *a = &m_pText[*tp + 1];
+  *opt = (*opt & (~c->Mask)) | c->Data;
+  if (c->Args == 1)
+  {
+    if (c->Mask == BACKGND_MASK)
+      *backDim = a[0];
+    else
+      *colDim = a[0];
+  }
+  else if (c->Args >= 3)
+  {
+    memcpy(col1, a, 3);
+    if (c->Args == 6)
+      memcpy(col2, a + 3, 3);
+  }
+  *tp += c->Args;
+}
+
+
+// Steps the text for a new frame, false if it has ended. Picks the incremental frame type.
+bool cLEDText::BeginFrame(cTextFrame &F, uint16_t Changes, int16_t Width, int16_t Height, bool RGB)
+{
+  F.RC = 0;
+  if ( (m_TextPos >= m_pSize) && (!MoreText()) )
+    return(false);
+  // A redraw while a delay or frame rate count is running gives the same pixels, unless
+  // something else drew on the matrix since our last frame or dimming is involved
+  F.Changed = (m_Redraw || (m_DelayCounter == 0) || (Changes != m_MatrixChanges));
+  F.Dimmed = false;
+  F.DirtyYMin = 0x7fff;
+  F.DirtyYMax = -1;
+  F.MfractAV = 65535 / ((m_YMax - m_YMin) + 1);
+  F.MfractAH = 65535 / ((m_XMax - m_XMin) + 1);
+  F.ColrTab = (m_ColrTab && RGB);
+  F.Stepped = ((m_DelayCounter == 0) && (Initialised == false));
   if (m_DelayCounter == 0)
   {
     if (Initialised == true)
@@ -253,8 +975,10 @@ int cLEDText::UpdateText()
     else
     {
       uint8_t fw;
-      if (m_FProp == true)
-        fw = m_FontData[(m_pText[m_TextPos] - m_FontBase) * m_FCBytes];
+      if ((m_Code != NULL) && (m_TextPos < m_pSize) && (m_Code[m_TextPos].Width != 0))
+        fw = m_Code[m_TextPos].Width;
+      else if (m_FProp == true)
+        fw = GlyphWidth(m_pText[m_TextPos]);
       else
       	fw = m_FontWidth;
       if (((m_Options & SCROLL_MASK) == SCROLL_LEFT) || ((m_Options & SCROLL_MASK) == SCROLL_RIGHT))
@@ -290,261 +1014,479 @@ int cLEDText::UpdateText()
     }
     if ((m_XBitPos == 0) && (m_YBitPos == 0))
     {
-      while ( (m_TextPos < m_pSize) && ((m_TextPos < m_EOLtp) || (m_pText[m_TextPos] > m_FontUpper)) )
+      while ( ((m_TextPos < m_pSize) || (MoreText())) && ((m_TextPos < m_EOLtp) || (m_pText[m_TextPos] > m_FontUpper)) )
       {
         if (m_pText[m_TextPos] > m_FontUpper)
-          DecodeOptions(&m_TextPos, &m_Options, &m_BackDim, m_Col1, m_Col2, &m_ColDim, &RC);
+          DecodeCode(&m_TextPos, &m_Options, &m_BackDim, m_Col1, m_Col2, &m_ColDim, &F.RC);
         m_TextPos++;
       }
     }
   }
   if ( ((m_Options & SCROLL_MASK) != SCROLL_RIGHT) && (m_TextPos >= m_pSize) )
-    return(-1);
-  tp = m_TextPos;
-  opt = m_Options;
-  bDim = m_BackDim;
-  memcpy(c1, m_Col1, sizeof(c1));
-  memcpy(c2, m_Col2, sizeof(c2));
-  cDim = m_ColDim;
-  if ((opt & SCROLL_MASK) == SCROLL_DOWN)
-    MinY = MaxY = m_YMin - m_YBitPos;
-  else
-    MaxY = MinY = m_YMax + m_YBitPos;
-  m_EOLtp = 0;
+    return(false);
+  // Incremental mode moves what the last frame drew and renders only the pixels scrolling in.
+  // The text is still walked in full, the effect codes in the window behave as before.
+  F.Scroll = m_Options & SCROLL_MASK;
+  F.Inc = INC_FULL;
+  if ( (m_Incremental) && (m_ShiftSafe) && (!m_Redraw) && (Changes == m_MatrixChanges) && (F.Scroll == m_LastScroll) )
+  {
+    if (!F.Stepped)
+      F.Inc = INC_HOLD;
+    else if (ShiftArea(Width, Height, F.sx0, F.sy0, F.sx1, F.sy1))
+    { // Vertically the line scrolling in is drawn before the walk is known to fill the window, so check first
+      if ((F.Scroll == SCROLL_LEFT) || (F.Scroll == SCROLL_RIGHT))
+        F.Inc = INC_SHIFT;
+      else
+        F.Inc = INC_PROBE;
+    }
+  }
+  if ( (m_Source != NULL) && (!m_SourceEnd) )
+    FitLookahead(F, Width, Height);
+  return(true);
+}
+
+
+// Walks the frame without drawing until the lookahead holds all the text it covers, its end is
+// only the end of the text once the source has ended. Codes met by the walk are undone.
+void cLEDText::FitLookahead(const cTextFrame &F, int16_t Width, int16_t Height)
+{
+  cTextFrame P;
+  uint16_t DelayCounter, LastDelayTP, LastCustomRCTP;
+
+  // Saved on each pass, MoreText() moves the positions with the text
   do
   {
-    xbp = m_XBitPos;
-    if ((opt & SCROLL_MASK) == SCROLL_RIGHT)
-      x = m_XMax;
+    DelayCounter = m_DelayCounter;
+    LastDelayTP = m_LastDelayTP;
+    LastCustomRCTP = m_LastCustomRCTP;
+    P = F;
+    P.Inc = INC_HOLD;
+    WalkText(P, Width, Height, NULL, NULL);
+    m_DelayCounter = DelayCounter;
+    m_LastDelayTP = LastDelayTP;
+    m_LastCustomRCTP = LastCustomRCTP;
+  }
+  while ( (P.End) && (MoreText()) );
+}
+
+
+// Walks the text in the window, Draw() gets each glyph column on the matrix in the area this frame draws
+void cLEDText::WalkText(cTextFrame &F, int16_t Width, int16_t Height, void *Matrix, tDrawColumn Draw)
+{
+  uint8_t xbp, xbpmax, fw;
+  int16_t x, y, MinY, MaxY, cx0, cx1, cy0, cy1, ShiftRows;
+  uint16_t opt, tp, fdo, gctp, gcopt;
+  const uint32_t *gc;
+  bool Safe, Cut, Stop;
+
+  for (;;)
+  {
+    cx0 = cy0 = -0x7fff;
+    cx1 = cy1 = 0x7fff;
+    if ((F.Inc == INC_HOLD) || (F.Inc == INC_PROBE))
+    {
+      cx0 = 1;
+      cx1 = 0;
+    }
+    else if (F.Inc == INC_SHIFT)
+    {
+      if (F.Scroll == SCROLL_LEFT)
+        cx0 = cx1 = F.sx1;
+      else if (F.Scroll == SCROLL_RIGHT)
+        cx0 = cx1 = F.sx0;
+      else if (F.Scroll == SCROLL_UP)
+        cy0 = cy1 = F.sy0;
+      else
+        cy0 = cy1 = F.sy1;
+    }
+    F.Shifted = Cut = Stop = false;
+    ShiftRows = -1;
+    tp = m_TextPos;
+    opt = m_Options;
+    Safe = ShiftSafe(opt);
+    F.bDim = m_BackDim;
+    memcpy(F.c1, m_Col1, sizeof(F.c1));
+    memcpy(F.c2, m_Col2, sizeof(F.c2));
+    F.cDim = m_ColDim;
+    if ((opt & SCROLL_MASK) == SCROLL_DOWN)
+      MinY = MaxY = m_YMin - m_YBitPos;
     else
-      x = m_XMin;
+      MaxY = MinY = m_YMax + m_YBitPos;
+    m_EOLtp = 0;
+    gc = NULL;
+    gctp = 0xffff;
+    gcopt = 0;
     do
     {
-      if ( (tp < m_pSize) && ((m_pText[tp] < m_FontBase) || (m_pText[tp] > m_FontUpper)) )
-      {
-        uint16_t oldopt = opt;
-        DecodeOptions(&tp, &opt, &bDim, c1, c2, &cDim, &RC);
-        tp++;
-        if ( (tp == (m_LastDelayTP + 3)) && (m_DelayCounter > 0) )
-        { // Fix to stop processing codes until delay expired
-          tp = m_pSize;
-          x = m_XMax + 1;
-        }
-        else if ((m_Options & INSTANT_OPTIONS_MODE) == INSTANT_OPTIONS_MODE)
-          opt = (opt & (~SCROLL_MASK)) | (oldopt & SCROLL_MASK);
-        else if ((oldopt & SCROLL_MASK) != (opt & SCROLL_MASK))
-        {
-          if (m_EOLtp == 0)
-            m_EOLtp = tp;
-          tp = m_pSize;
-          x = m_XMax + 1;
-          opt = oldopt;
-        }
-      }
+      xbp = m_XBitPos;
+      if ((opt & SCROLL_MASK) == SCROLL_RIGHT)
+        x = m_XMax;
       else
+        x = m_XMin;
+      do
       {
-        uint8_t fw, xbpmax;
-        uint16_t fdo = (m_pText[tp] - m_FontBase) * m_FCBytes;
-        if (m_FProp == true)
-          fw = m_FontData[fdo++];
-        else
-          fw = m_FontWidth;
-        if ((x < 0) || (x >= (*m_Matrix).Width()))
+        if ( (tp < m_pSize) && ((m_pText[tp] < m_FontBase) || (m_pText[tp] > m_FontUpper)) )
         {
-          if ( ((opt & CHAR_MASK) == CHAR_UP) || ((opt & CHAR_MASK) == CHAR_DOWN) )
-            xbpmax = fw;
-          else
-            xbpmax = m_FontHeight;
+          uint16_t oldopt = opt;
+          DecodeCode(&tp, &opt, &F.bDim, F.c1, F.c2, &F.cDim, &F.RC);
+          tp++;
+          if ( (tp == (m_LastDelayTP + 3)) && (m_DelayCounter > 0) )
+          { // Fix to stop processing codes until delay expired
+            tp = m_pSize;
+            x = m_XMax + 1;
+            Cut = Stop = true;
+          }
+          else if ((m_Options & INSTANT_OPTIONS_MODE) == INSTANT_OPTIONS_MODE)
+            opt = (opt & (~SCROLL_MASK)) | (oldopt & SCROLL_MASK);
+          else if ((oldopt & SCROLL_MASK) != (opt & SCROLL_MASK))
+          {
+            if (m_EOLtp == 0)
+              m_EOLtp = tp;
+            tp = m_pSize;
+            x = m_XMax + 1;
+            opt = oldopt;
+            Cut = Stop = true;
+          }
+          Safe = Safe && ShiftSafe(opt);
         }
         else
         {
-          uint8_t bf, xgap;
-          if ( ((opt & CHAR_MASK) == CHAR_UP) || ((opt & CHAR_MASK) == CHAR_DOWN) )
+          if ((m_Code != NULL) && (tp < m_pSize))
           {
-            if ((opt & SCROLL_MASK) == SCROLL_DOWN)
-              MaxY = MinY + m_FontHeight;
-            else
-              MinY = MaxY - m_FontHeight;
-            xbpmax = fw;
-            if ((opt & CHAR_MASK) == CHAR_UP)
+            fdo = m_Code[tp].Data;
+            fw = m_Code[tp].Width;
+          }
+          else if (tp >= m_pSize)
+          { // Blank column after the text, there is no character to look up
+            fdo = 0;
+            fw = m_FontWidth;
+          }
+          else
+          {
+            fdo = GlyphIndex(m_pText[tp]) * m_FCBytes;
+            if (m_FProp == true)
             {
-              if ((opt & SCROLL_MASK) == SCROLL_RIGHT)
-              {
-                bf = 0x80 >> ((fw - xbp) % 8);
-                fdo += ((fw - xbp) / 8);
-              }
-              else
-              {
-                bf = 0x80 >> (xbp % 8);
-                fdo += (xbp / 8);
-              }
-              fdo += ((m_FontHeight - 1) * m_FWBytes);
+              fw = GlyphWidth(m_pText[tp]);
+              ++fdo;
             }
             else
-            {
-              if ((opt & SCROLL_MASK) == SCROLL_RIGHT)
-              {
-                bf = 0x80 >> ((xbp - 1) % 8);
-                fdo += ((xbp - 1) / 8);
-              }
-              else
-              {
-                bf = 0x80 >> (((fw - xbp) - 1) % 8);
-                fdo += (((fw - xbp) - 1) / 8);
-              }
-            }
+              fw = m_FontWidth;
+          }
+          if (m_Incremental)
+          { // A horizontal shift only works if every glyph covers the same rows
+            int16_t h = (((opt & CHAR_MASK) == CHAR_UP) || ((opt & CHAR_MASK) == CHAR_DOWN)) ? m_FontHeight : fw;
+            if (ShiftRows < 0)
+              ShiftRows = h;
+            else if (ShiftRows != h)
+              Safe = false;
           }
+          if ( ((opt & CHAR_MASK) == CHAR_UP) || ((opt & CHAR_MASK) == CHAR_DOWN) )
+            xbpmax = fw;
           else
-          {
-            if ((opt & SCROLL_MASK) == SCROLL_DOWN)
-              MaxY = MinY + fw;
-            else
-              MinY = MaxY - fw;
             xbpmax = m_FontHeight;
-            if ((opt & CHAR_MASK) == CHAR_LEFT)
+          if ((x >= 0) && (x < Width))
+          {
+            if ( ((opt & CHAR_MASK) == CHAR_UP) || ((opt & CHAR_MASK) == CHAR_DOWN) )
             {
-              bf = 0x80;
-              if ((opt & SCROLL_MASK) == SCROLL_RIGHT)
-                fdo += ((m_FontHeight - xbp) * m_FWBytes);
+              if ((opt & SCROLL_MASK) == SCROLL_DOWN)
+                MaxY = MinY + m_FontHeight;
               else
-                fdo += (xbp * m_FWBytes);
+                MinY = MaxY - m_FontHeight;
             }
             else
             {
-              bf = 0x80 >> ((fw - 1) % 8);
-              fdo += ((fw - 1) / 8);
-              if ((opt & SCROLL_MASK) == SCROLL_RIGHT)
-                fdo += ((xbp - 1) * m_FWBytes);
+              if ((opt & SCROLL_MASK) == SCROLL_DOWN)
+                MaxY = MinY + fw;
               else
-                fdo += ((m_FontHeight - xbp - 1) * m_FWBytes);
+                MinY = MaxY - fw;
             }
-          }
-          if ( ((opt & SCROLL_MASK) == SCROLL_RIGHT) || (tp >= m_pSize) )
-            xgap = 0;
-          else
-            xgap = xbpmax;
-          uint16_t MfractCV = 65535 / (MaxY - MinY);
-          uint16_t MfractCH = 65535 / xbpmax;
-          y = MinY - 1;
-          while (y <= MaxY)
-          {
-            if ((y >= 0) && (y < (*m_Matrix).Height()))
+            if ((x >= cx0) && (x <= cx1) && (MaxY >= cy0) && ((MinY - 1) <= cy1))
             {
-              if ( (xbp != xgap) && (y >= MinY) && (y < MaxY) && ((m_FontData[fdo] & bf) != 0x00) )
+              F.gb = NULL;
+              F.bf = 0;
+              F.cbits = 0;
+              if ((m_GlyphBits != NULL) && (tp < m_pSize))
               {
-                if ((opt & COLR_MASK) != COLR_EMPTY)
+                if ((gctp != tp) || (gcopt != opt))
                 {
-                  if ((opt & COLR_MASK) == COLR_DIMMING)
-                    (*m_Matrix)(x, y).nscale8(cDim);
-                  else
-                  {
-                    uint8_t v[3];
-                    if ((opt & COLR_GRAD) == COLR_SINGLE)
-                      memcpy(v, c1, sizeof(v));
-                    else
-                    {
-                      uint16_t fract;
-                      if ((opt & (COLR_AREA | COLR_HORI)) == (COLR_CHAR | COLR_VERT))
-                        fract = (y - MinY) * MfractCV;
-                      else if ((opt & (COLR_AREA | COLR_HORI)) == (COLR_AREA | COLR_VERT))
-                        fract = (y - m_YMin) * MfractAV;
-                      else if ((opt & (COLR_AREA | COLR_HORI)) == (COLR_CHAR | COLR_HORI))
-                        fract = xbp * MfractCH;
-                      else /* if ((opt & (COLR_AREA | COLR_HORI)) == (COLR_AREA | COLR_HORI)) */
-                        fract = (x - m_XMin) * MfractAH;
-                      for (int i=0; i<3; i++)
-                      {
-                        if (c1[i] <= c2[i])
-                          v[i] = lerp16by16(c1[i]<<8, c2[i]<<8, fract) >> 8;
-                        else
-                          v[i] = lerp16by16(c2[i]<<8, c1[i]<<8, ~fract) >> 8;
-                      }
-                    }
-                    if ((opt & COLR_HSV) == COLR_RGB)
-                      (*m_Matrix)(x, y) = CRGB(v[0], v[1], v[2]);
-                    else
-                      (*m_Matrix)(x, y) = CHSV(v[0], v[1], v[2]);
-                  }
+                  gc = GlyphColumns(m_pText[tp], opt);
+                  gctp = tp;
+                  gcopt = opt;
                 }
+                F.cbits = gc[xbp];
               }
-              else if ( (((opt & SCROLL_MASK) == SCROLL_DOWN) && ( (MinY <= m_YMin) || (y >= MinY)))
-                      || (((opt & SCROLL_MASK) != SCROLL_DOWN) && ( (MaxY >= m_YMax) || (y < MaxY))) )
-              // Fix for double dimming/blanking of blank vertical gap lines
-              {
-                if ((opt & BACKGND_MASK) == BACKGND_ERASE)
-                  (*m_Matrix)(x, y) = CRGB(0, 0, 0);
-                else if ((opt & BACKGND_MASK) == BACKGND_DIMMING)
-                  (*m_Matrix)(x, y).nscale8(bDim);
-              }
-            }
-            if ((y >= MinY) && (xbp != xgap))
-            {
-              if ((opt & CHAR_MASK) == CHAR_UP)
-                fdo -= m_FWBytes;
-              else if ((opt & CHAR_MASK) == CHAR_DOWN)
-                fdo += m_FWBytes;
-              else if ((opt & CHAR_MASK) == CHAR_LEFT)
+              else
               {
-                if (bf == 0x01)
-                {
-                  bf = 0x80;
-                  ++fdo;
-                }
-                else
-                  bf >>= 1;
+                gc = NULL;
+                gctp = 0xffff;
+                if ( (tp < m_pSize) && ((F.gb = FontGlyph(m_pText[tp])) != NULL) )
+                  fdo = 0;
+                GlyphBitStart(opt, fw, xbp, &fdo, &F.bf);
               }
-              else if ((opt & CHAR_MASK) == CHAR_RIGHT)
+              if ( ((opt & SCROLL_MASK) == SCROLL_RIGHT) || (tp >= m_pSize) )
+                F.xgap = 0;
+              else
+                F.xgap = xbpmax;
+              F.MfractCV = 65535 / (MaxY - MinY);
+              F.MfractCH = 65535 / xbpmax;
+              // Table colour of row y is ct[cti + y], a column colour is ct[cti]
+              F.ct = NULL;
+              F.cti = F.ctr = 0;
+              if ( (F.ColrTab) && ((opt & COLR_MASK) != COLR_EMPTY) && ((opt & COLR_MASK) != COLR_DIMMING) )
               {
-                if (bf == 0x80)
+                F.ct = ColrTable(opt, F.c1, F.c2, MaxY - MinY, xbpmax, Width, Height);
+                if ((opt & COLR_GRAD) == COLR_SINGLE)
+                  F.cti = 0;
+                else if ((opt & (COLR_AREA | COLR_HORI)) == (COLR_CHAR | COLR_VERT))
                 {
-                  bf = 0x01;
-                  --fdo;
+                  F.cti = -MinY;
+                  F.ctr = 1;
                 }
+                else if ((opt & (COLR_AREA | COLR_HORI)) == (COLR_AREA | COLR_VERT))
+                  F.ctr = 1;
+                else if ((opt & (COLR_AREA | COLR_HORI)) == (COLR_CHAR | COLR_HORI))
+                  F.cti = xbp;
                 else
-                  bf <<= 1;
+                  F.cti = x;
               }
+              F.DirtyYMin = min(F.DirtyYMin, (int16_t)(MinY - 1));
+              F.DirtyYMax = max(F.DirtyYMax, MaxY);
+              F.opt = opt;
+              F.fdo = fdo;
+              F.x = x;
+              F.MinY = MinY;
+              F.MaxY = MaxY;
+              F.cy0 = cy0;
+              F.cy1 = cy1;
+              F.xbp = xbp;
+              F.Bits = (gc != NULL);
+              Draw(this, Matrix, F);
             }
-            ++y;
           }
-        }
-        ++xbp;
-        if (xbp > xbpmax)
-        {
-          xbp = 0;
-          ++tp;
-        }
-        if ((opt & SCROLL_MASK) != SCROLL_RIGHT)
-        {
-          ++x;
-          if (tp == m_pSize)
-            ++tp;
-        }
-        else
-        {
-          --x;
-          if ((tp == m_pSize) && (xbp > 0))
+          ++xbp;
+          if (xbp > xbpmax)
+          {
+            xbp = 0;
             ++tp;
+          }
+          if ((opt & SCROLL_MASK) != SCROLL_RIGHT)
+          {
+            ++x;
+            if (tp == m_pSize)
+              ++tp;
+          }
+          else
+          {
+            --x;
+            if ((tp == m_pSize) && (xbp > 0))
+              ++tp;
+          }
         }
       }
+      while ((x >= m_XMin) && (x <= m_XMax) && (tp <= m_pSize));
+      if (tp > m_pSize)
+        Cut = true;
+      if (xbp != 0)
+        ++tp;
+      if (m_EOLtp == 0)
+        m_EOLtp = tp;
+      if ((opt & SCROLL_MASK) == SCROLL_DOWN)
+        y = MinY = MaxY + 1;
+      else if ((opt & SCROLL_MASK) == SCROLL_UP)
+        y = MaxY = MinY - 1;
+      else
+        y = m_YMin - 1;
     }
-    while ((x >= m_XMin) && (x <= m_XMax) && (tp <= m_pSize));
-    if (xbp != 0)
-      ++tp;
-    if (m_EOLtp == 0)
-      m_EOLtp = tp;
-    if ((opt & SCROLL_MASK) == SCROLL_DOWN)
-      y = MinY = MaxY + 1;
-    else if ((opt & SCROLL_MASK) == SCROLL_UP)
-      y = MaxY = MinY - 1;
-    else
-      y = m_YMin - 1;
+    while ((y >= m_YMin) && (y <= m_YMax) && (tp < m_pSize));
+    if ((y >= m_YMin) && (y <= m_YMax))
+      Cut = true;
+    if (F.Inc == INC_PROBE)
+      F.Inc = (Cut ? INC_FULL : INC_SHIFT);
+    else if ((F.Inc != INC_SHIFT) || (F.Shifted))
+      break;
+    else // The walk ended before the line scrolling in, so the last frame was not all text either
+      F.Inc = INC_FULL;
   }
-  while ((y >= m_YMin) && (y <= m_YMax) && (tp < m_pSize));
+  F.tp = tp;
+  F.x = x;
+  F.y = y;
+  F.Safe = Safe;
+  F.End = ((tp >= m_pSize) && (!Stop));
+  F.ShiftRows = ShiftRows;
+}
+
+
+int cLEDText::EndFrame(cTextFrame &F)
+{
+  m_WalkDelay = m_DelayCounter;
+  m_ShiftSafe = (F.Safe && (F.ShiftRows >= 0));
+  m_ShiftRows = F.ShiftRows;
+  m_LastScroll = F.Scroll;
+  m_Redraw = false;
   if (m_DelayCounter > 0)
     m_DelayCounter--;
   else if (m_FrameRate > 0)
     m_DelayCounter = m_FrameRate;
-  if ( (m_Options & INSTANT_OPTIONS_MODE) && (tp > m_pSize) && ( ((y >= m_YMin) && (y <= m_YMax)) || ((x >= m_XMin) && (x <= m_XMax)) ) )
+  if ( (m_Options & INSTANT_OPTIONS_MODE) && (F.tp > m_pSize) && ( ((F.y >= m_YMin) && (F.y <= m_YMax)) || ((F.x >= m_XMin) && (F.x <= m_XMax)) ) )
     return(-1);
-  return(RC);
+  return(F.RC);
+}
+
+
+int cLEDText::UpdateText()
+{
+  return(StepText(*m_Matrix));
+}
+
+
+// Measure() renders into this, at 0 x 0 every column is off the matrix so no glyph is fetched or pixel drawn
+struct cNullPixel
+{
+  template <class T> cNullPixel &operator=(const T &Colr) { return(*this); }
+  void nscale8(uint8_t Scale) {}
+};
+
+class cNullMatrix
+{
+  public:
+    cNullPixel &operator()(int16_t x, int16_t y) { return(m_Pixel); }
+    int Width() { return(0); }
+    int Height() { return(0); }
+    uint16_t ChangeCount() { return(0); }
+    void MarkDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {}
+    void ShiftLeft() {}
+    void ShiftRight() {}
+    void ShiftUp() {}
+    void ShiftDown() {}
+  private:
+    cNullPixel m_Pixel;
+};
+
+
+void cLEDText::Measure(cTextMeasure *Result, uint16_t FrameMillis, uint8_t StopRC)
+{
+  cNullMatrix Null;
+  // What playing the text changes, put back afterwards so the scroll in progress is left alone
+  cTextSource *Source = m_Source;
+  uint32_t *GlyphBits = m_GlyphBits;
+  uint16_t TextPos = m_TextPos, EOLtp = m_EOLtp, Options = m_Options, LastScroll = m_LastScroll, MatrixChanges = m_MatrixChanges;
+  uint16_t LastDelayTP = m_LastDelayTP, LastCustomRCTP = m_LastCustomRCTP, DelayCounter = m_DelayCounter, WalkDelay = m_WalkDelay;
+  uint8_t XBitPos = m_XBitPos, YBitPos = m_YBitPos, BackDim = m_BackDim, ColDim = m_ColDim, FrameRate = m_FrameRate, Col1[3], Col2[3];
+  int16_t ShiftRows = m_ShiftRows;
+  bool Incremental = m_Incremental, ColrTab = m_ColrTab, ShiftSafe = m_ShiftSafe, Init = Initialised, Redraw = m_Redraw;
+  uint16_t tp, opt;
+  uint8_t bDim, cDim, c1[3], c2[3], RC;
+  int rc;
+
+  memcpy(Col1, m_Col1, sizeof(Col1));
+  memcpy(Col2, m_Col2, sizeof(Col2));
+  // Plays the text from the start as after SetText(), in this object so its buffers stay its own.
+  // A SetSource() text cannot be read twice, only what is in its window is measured.
+  m_Source = NULL;
+  m_GlyphBits = NULL;
+  m_Incremental = m_ColrTab = false;
+  m_TextPos = m_EOLtp = m_XBitPos = m_YBitPos = 0;
+  m_LastDelayTP = m_LastCustomRCTP = m_DelayCounter = 0;
+  Initialised = m_Redraw = true;
+  Result->Frames = Result->Steps = 0;
+  do
+  {
+    if (m_DelayCounter == 0)
+      ++Result->Steps;
+    rc = RenderText(Null);
+    ++Result->Frames;
+  }
+  while ( (rc != -1) && ((StopRC == 0) || (rc != StopRC)) );
+  Result->RC = rc;
+  if (FrameMillis != 0)
+    Result->Millis = Result->Frames * FrameMillis;
+  else if (m_TickRate != 0)
+    Result->Millis = ((uint64_t)Result->Frames * 1000) / m_TickRate;
+  else
+    Result->Millis = 0;
+  // Columns of the line in the text direction in force at each glyph
+  opt = Options;
+  bDim = BackDim;
+  cDim = ColDim;
+  Result->Pixels = 0;
+  for (tp=0; tp<m_pSize; ++tp)
+  {
+    uint8_t ch = m_pText[tp];
+    if ((ch < m_FontBase) || (ch > m_FontUpper))
+      DecodeCode(&tp, &opt, &bDim, c1, c2, &cDim, &RC);
+    else if ( ((opt & CHAR_MASK) == CHAR_UP) || ((opt & CHAR_MASK) == CHAR_DOWN) )
+    {
+      if (m_Code != NULL)
+        Result->Pixels += m_Code[tp].Width + 1;
+      else if (m_FProp == true)
+        Result->Pixels += GlyphWidth(ch) + 1;
+      else
+        Result->Pixels += m_FontWidth + 1;
+    }
+    else
+      Result->Pixels += m_FontHeight + 1;
+  }
+  m_Source = Source;
+  m_GlyphBits = GlyphBits;
+  m_TextPos = TextPos;
+  m_EOLtp = EOLtp;
+  m_Options = Options;
+  m_LastScroll = LastScroll;
+  m_MatrixChanges = MatrixChanges;
+  m_LastDelayTP = LastDelayTP;
+  m_LastCustomRCTP = LastCustomRCTP;
+  m_DelayCounter = DelayCounter;
+  m_WalkDelay = WalkDelay;
+  m_XBitPos = XBitPos;
+  m_YBitPos = YBitPos;
+  m_BackDim = BackDim;
+  m_ColDim = ColDim;
+  m_FrameRate = FrameRate;
+  memcpy(m_Col1, Col1, sizeof(m_Col1));
+  memcpy(m_Col2, Col2, sizeof(m_Col2));
+  m_ShiftRows = ShiftRows;
+  m_Incremental = Incremental;
+  m_ColrTab = ColrTab;
+  m_ShiftSafe = ShiftSafe;
+  Initialised = Init;
+  m_Redraw = Redraw;
+}
+
+
+int cLEDText::SkipFrames(uint16_t Frames)
+{
+  cNullMatrix Null;
+  int rc = 0;
+
+  while ( (Frames-- > 0) && (rc == 0) )
+  {
+    if (m_Source != NULL)
+      FillText();
+    rc = RenderText(Null);
+  }
+  // What is on the matrix is more than one step behind, the next frame draws everything
+  m_Redraw = true;
+  return(rc);
+}
+
+
+void cLEDText::SetFrameClock(uint16_t FramesPerSecond)
+{
+  m_TickRate = FramesPerSecond;
+  m_TickInc = ((uint64_t)FramesPerSecond << 32) / 1000000;  // Frames per microsecond, 0.32 fixed point
+  ClockRestart();
+}
+
+
+uint16_t cLEDText::ClockTicks()
+{
+  uint32_t Now = micros();
+  uint64_t t;
+
+  // The fraction of a frame left over is kept, so the rate is exact over time
+  t = ((uint64_t)(Now - m_TickTime) * m_TickInc) + m_TickFract;
+  m_TickTime = Now;
+  m_TickFract = (uint32_t)t;
+  t >>= 32;
+  return((t > CLOCK_TICKS_MAX) ? CLOCK_TICKS_MAX : (uint16_t)t);
 }
@@ -2,6 +2,8 @@
 #define LEDText_h
 
 #define  FONT_PROPORTIONAL  0x80
+#define  FONT_PACKED        0x80   // In the height byte, see FontPack example
+#define  FONT_SPARSE        0x40   // In the height byte, only the characters listed after the header
 
 #define  BACKGND_ERASE   0x0000
 #define  BACKGND_LEAVE   0x0001
@@ -37,6 +39,10 @@
 
 #define  INSTANT_OPTIONS_MODE    0x1000
 
+// Colours are palette indexes for cLEDMatrixIndexed: the first byte of a colour is the index, gradients
+// step from one index to the other. Colour codes in the text keep it, other matrices ignore it.
+#define  COLR_INDEX              0x2000
+
 #define  EFFECT_CHAR_UP          "\xd8"
 #define  EFFECT_CHAR_DOWN        "\xd9"
 #define  EFFECT_CHAR_LEFT        "\xda"
@@ -83,9 +89,113 @@
 #endif
 
 
+// SetText(..., true) resolves every text position once, the renderer then reads these instead of the font and DecodeOptions()
+struct cTextCode
+{
+  uint16_t Data;    // Glyph: font data offset of the bitmap, Code: option bits set
+  uint16_t Mask;    // Code: option bits replaced
+  uint8_t Width;    // Glyph: width in pixels, 0 for codes
+  uint8_t Args;     // Code: argument bytes, TEXTCODE_DECODE = stateful, left to DecodeOptions()
+};
+
+#define  TEXTCODE_DECODE       0xff
+
+// SetGlyphCache() keeps recently drawn glyphs as one bitmask per column for the orientation they were drawn in
+struct cGlyphSlot
+{
+  uint16_t Key;     // Character | orientation << 6, GLYPH_EMPTY if unused
+  uint16_t Used;    // Clock of the last lookup, the oldest slot is replaced
+};
+
+#define  GLYPH_EMPTY           0xffff
+#define  GLYPH_MAX_BITS        32
+
+// Glyph bitmaps held in RAM, packed fonts are only unpacked on a miss
+#define  FONT_PLAIN_GLYPHS     1
+#define  FONT_PACKED_GLYPHS    4
+
+// SetIncremental() frame types
+#define  INC_FULL              0     // Everything in the window is drawn
+#define  INC_HOLD              1     // Nothing moved, nothing is drawn
+#define  INC_SHIFT             2     // Window moved by one pixel, only the line scrolling in is drawn
+#define  INC_PROBE             3     // Nothing drawn, checks the text still fills the window before a vertical shift
+
+// One RenderText() frame, set up by BeginFrame(), each column WalkText() hands to DrawColumn(), read by EndFrame()
+struct cTextFrame
+{
+  uint16_t Scroll, MfractAV, MfractAH;
+  int16_t sx0, sy0, sx1, sy1;   // SetIncremental() area moved by INC_SHIFT
+  int16_t DirtyYMin, DirtyYMax;
+  uint8_t Inc, RC;
+  bool Changed, Dimmed, Stepped, ColrTab, Shifted;
+  // The column to draw, glyph column xbp at x from MinY to MaxY, clipped to cy0..cy1
+  uint16_t opt, fdo, MfractCV, MfractCH;
+  int16_t x, MinY, MaxY, cy0, cy1;
+  uint8_t xbp, xgap, bf, bDim, cDim, c1[3], c2[3];
+  uint32_t cbits;               // Glyph cache column, if Bits
+  const uint8_t *gb;            // Else the glyph bitmap read at fdo, bf
+  const struct CRGB *ct;        // Colour table, row y is ct[cti + y * ctr]
+  int16_t cti, ctr;
+  bool Bits;
+  // Where the walk ended, End if it ran into the end of m_pText rather than stopping at a code
+  uint16_t tp;
+  int16_t y, ShiftRows;
+  bool Safe, End;
+};
+
+// SetSource() pulls the text through a small window, so it never has to be in RAM all at once
+class cTextSource
+{
+  public:
+    // Copies up to Len of the next bytes of the text to Dst, returns how many, 0 once the text has ended
+    virtual uint16_t Read(unsigned char *Dst, uint16_t Len) = 0;
+};
+
+#define  TEXT_SEGMENTS_MAX     4
+
+// MoreText() grows a SetSource() window no larger than this, a frame needing more is cut at its end
+#ifndef TEXT_WINDOW_MAX
+  #define  TEXT_WINDOW_MAX     512
+#endif
+
+// Text source reading several RAM buffers one after the other, e.g. effect codes around a message
+class cTextSegments : public cTextSource
+{
+  public:
+    cTextSegments() : m_Segments(0), m_Seg(0), m_Ofs(0) {}
+    bool Add(const unsigned char *Data, uint16_t Len);
+    void Clear() { m_Segments = 0; Rewind(); }
+    void Rewind() { m_Seg = 0; m_Ofs = 0; }
+    virtual uint16_t Read(unsigned char *Dst, uint16_t Len);
+  private:
+    const unsigned char *m_Data[TEXT_SEGMENTS_MAX];
+    uint16_t m_Len[TEXT_SEGMENTS_MAX];
+    uint8_t m_Segments, m_Seg;
+    uint16_t m_Ofs;
+};
+
+// SetFrameClock() frames are ticks of a clock, a stalled loop catches up by at most this many undrawn frames
+#define  CLOCK_TICKS_MAX       255
+
+// Measure() plays the text without drawing it, frame rate and delay codes included
+struct cTextMeasure
+{
+  uint32_t Pixels;  // Length of the text line, each glyph plus its gap column
+  uint32_t Steps;   // Frames that moved the text, the rest repeat one for the frame rate or a delay
+  uint32_t Frames;  // UpdateText() calls up to and including the one returning -1 or StopRC
+  uint32_t Millis;  // Frames at FrameMillis each, or at the SetFrameClock() rate
+  int RC;           // What the last of those calls returned
+};
+
+
 class cLEDText
 {
   public:
+    cLEDText() : m_FontData(NULL), m_FontSlot(NULL), m_FontSlotBytes(0), m_Code(NULL), m_GlyphSlot(NULL), m_GlyphBits(NULL), m_GlyphSlots(0), m_Incremental(false), m_ColrTable(NULL), m_ColrSize(0), m_ColrCount(0), m_ColrTab(false), m_TickRate(0), m_Source(NULL), m_NextSource(NULL), m_Window(NULL) {}
+    ~cLEDText();
+    // Owns its glyph, code and window buffers, so it is not copied
+    cLEDText(const cLEDText &) = delete;
+    cLEDText &operator=(const cLEDText &) = delete;
     void SetFont(const uint8_t *FontData);
     void Init(cLEDMatrixBase *Matrix, uint16_t Width, uint16_t Height, int16_t OriginX = 0, int16_t OriginY = 0);
     void SetBackgroundMode(uint16_t Options, uint8_t Dimming = 0x00);
@@ -94,23 +204,450 @@ class cLEDText
     void SetTextColrOptions(uint16_t Options, uint8_t ColA1 = 0xff, uint8_t ColA2 = 0xff, uint8_t ColA3 = 0xff, uint8_t ColB1 = 0xff, uint8_t ColB2 = 0xff, uint8_t ColB3 = 0xff);
     void SetFrameRate(uint8_t Rate);
     void SetOptionsChangeMode(uint16_t Options);
-    void SetText(unsigned char *Txt, uint16_t TxtSize);
+    void SetText(const unsigned char *Txt, uint16_t TxtSize, bool Compile = false);
+    bool SetSource(cTextSource *Source, uint16_t Lookahead = 64);
+    bool QueueSource(cTextSource *Next);
+    cTextSource *Source() { return(m_Source); };
+    bool SourceQueued() { return(m_NextSource != NULL); };
+    bool SetGlyphCache(uint8_t Glyphs);
+    void SetIncremental(bool Incremental);
+    void SetColrTable(bool Enable);
+    void SetFrameClock(uint16_t FramesPerSecond);
     int UpdateText();
+    void Measure(cTextMeasure *Result, uint16_t FrameMillis = 0, uint8_t StopRC = 0);
     uint8_t FontWidth()  { return(m_FontWidth); };
     uint8_t FontHeight() { return(m_FontHeight); };
-  private:
+  protected:
+    static constexpr uint16_t BACKGND_MASK = (BACKGND_ERASE | BACKGND_LEAVE | BACKGND_DIMMING);
+    static constexpr uint16_t CHAR_MASK = (CHAR_UP | CHAR_DOWN | CHAR_LEFT | CHAR_RIGHT);
+    static constexpr uint16_t SCROLL_MASK = (SCROLL_LEFT | SCROLL_RIGHT | SCROLL_UP | SCROLL_DOWN);
+    static constexpr uint16_t COLR_MASK = (COLR_RGB | COLR_HSV | COLR_SINGLE | COLR_GRAD | COLR_CHAR | COLR_AREA | COLR_VERT | COLR_HORI | COLR_EMPTY | COLR_DIMMING);
+    template <class tMatrix> friend class cLEDTextScene;
+    template <class tMatrix> int RenderText(tMatrix &Matrix);
+    // RenderText() steps and walks the text in these, DrawColumn() is all that depends on the matrix type
+    typedef void (*tDrawColumn)(cLEDText *Text, void *Matrix, cTextFrame &F);
+    bool BeginFrame(cTextFrame &F, uint16_t Changes, int16_t Width, int16_t Height, bool RGB);
+    void WalkText(cTextFrame &F, int16_t Width, int16_t Height, void *Matrix, tDrawColumn Draw);
+    int EndFrame(cTextFrame &F);
+    template <class tMatrix> void DrawColumn(tMatrix &Matrix, cTextFrame &F);
+    template <class tMatrix> static void DrawThunk(cLEDText *Text, void *Matrix, cTextFrame &F) { Text->DrawColumn(*(tMatrix *)Matrix, F); }
+    template <class tMatrix> void RedrawText(tMatrix &Matrix);
+    template <class tMatrix> int StepText(tMatrix &Matrix);
+    uint16_t ClockTicks();
+    void ClockRestart() { m_TickTime = micros(); m_TickFract = 0; }
+    int SkipFrames(uint16_t Frames);
+    void FillText();
+    bool MoreText();
+    void FitLookahead(const cTextFrame &F, int16_t Width, int16_t Height);
     void DecodeOptions(uint16_t *tp, uint16_t *opt, uint8_t *backDim, uint8_t *col1, uint8_t *col2, uint8_t *colDim, uint8_t *RC);
+    void DecodeCode(uint16_t *tp, uint16_t *opt, uint8_t *backDim, uint8_t *col1, uint8_t *col2, uint8_t *colDim, uint8_t *RC);
+    void CompileText();
+    bool AllocGlyphCache();
+    // First font byte and bit of glyph column xbp, then the next bit along that column
+    inline void GlyphBitStart(uint16_t opt, uint8_t fw, uint8_t xbp, uint16_t *fdo, uint8_t *bf)
+    {
+      if ((opt & CHAR_MASK) == CHAR_UP)
+      {
+        if ((opt & SCROLL_MASK) == SCROLL_RIGHT)
+        {
+          *bf = 0x80 >> ((fw - xbp) % 8);
+          *fdo += ((fw - xbp) / 8);
+        }
+        else
+        {
+          *bf = 0x80 >> (xbp % 8);
+          *fdo += (xbp / 8);
+        }
+        *fdo += ((m_FontHeight - 1) * m_FWBytes);
+      }
+      else if ((opt & CHAR_MASK) == CHAR_DOWN)
+      {
+        if ((opt & SCROLL_MASK) == SCROLL_RIGHT)
+        {
+          *bf = 0x80 >> ((xbp - 1) % 8);
+          *fdo += ((xbp - 1) / 8);
+        }
+        else
+        {
+          *bf = 0x80 >> (((fw - xbp) - 1) % 8);
+          *fdo += (((fw - xbp) - 1) / 8);
+        }
+      }
+      else if ((opt & CHAR_MASK) == CHAR_LEFT)
+      {
+        *bf = 0x80;
+        if ((opt & SCROLL_MASK) == SCROLL_RIGHT)
+          *fdo += ((m_FontHeight - xbp) * m_FWBytes);
+        else
+          *fdo += (xbp * m_FWBytes);
+      }
+      else
+      {
+        *bf = 0x80 >> ((fw - 1) % 8);
+        *fdo += ((fw - 1) / 8);
+        if ((opt & SCROLL_MASK) == SCROLL_RIGHT)
+          *fdo += ((xbp - 1) * m_FWBytes);
+        else
+          *fdo += ((m_FontHeight - xbp - 1) * m_FWBytes);
+      }
+    }
+    inline void GlyphBitStep(uint16_t opt, uint16_t *fdo, uint8_t *bf)
+    {
+      if ((opt & CHAR_MASK) == CHAR_UP)
+        *fdo -= m_FWBytes;
+      else if ((opt & CHAR_MASK) == CHAR_DOWN)
+        *fdo += m_FWBytes;
+      else if ((opt & CHAR_MASK) == CHAR_LEFT)
+      {
+        if (*bf == 0x01)
+        {
+          *bf = 0x80;
+          ++*fdo;
+        }
+        else
+          *bf >>= 1;
+      }
+      else if ((opt & CHAR_MASK) == CHAR_RIGHT)
+      {
+        if (*bf == 0x80)
+        {
+          *bf = 0x01;
+          --*fdo;
+        }
+        else
+          *bf <<= 1;
+      }
+    }
+    const uint32_t *GlyphColumns(uint8_t Ch, uint16_t Opt);
+    // Fonts live in flash (PROGMEM), glyph bitmaps are copied to RAM with aligned 32 bit reads or unpacked
+    void FontRead(uint16_t Offset, uint8_t *Dst, uint16_t Len);
+    bool AllocFontGlyphs();
+    const uint8_t *FetchGlyph(uint8_t Ch);
+    void UnpackGlyph(uint8_t Ch, uint8_t *Dst);
+    int16_t SparseIndex(uint8_t Ch);
+    inline uint8_t FontByte(uint16_t Offset) { return(pgm_read_byte(&m_FontData[Offset])); }
+    inline uint8_t GlyphWidth(uint8_t Ch)
+    { // Proportional fonts only, packed ones keep the widths in a table of their own
+      return(FontByte(m_FPacked ? GlyphIndex(Ch) : (GlyphIndex(Ch) * m_FCBytes)));
+    }
+    // Glyph number of a character, sparse fonts binary search their sorted character list
+    inline int16_t GlyphIndex(uint8_t Ch)
+    {
+      if (!m_FSparse)
+        return(Ch - m_FontBase);
+      if (Ch == m_FLastCh)
+        return(m_FLastGlyph);
+      return(SparseIndex(Ch));
+    }
+    inline const uint8_t *FontGlyph(uint8_t Ch)
+    {
+      if ( (m_FontSlot != NULL) && (m_FontSlot[m_FontLast].Key == Ch) )
+        return(&m_FontGlyph[m_FontLast * m_FWBytes * m_FontHeight]);
+      return(FetchGlyph(Ch));
+    }
+    // Byte fdo of the fetched glyph, or of the font if there was no RAM for the copy
+    inline uint8_t GlyphByte(const uint8_t *Glyph, uint16_t fdo) { return((Glyph != NULL) ? Glyph[fdo] : (m_FPacked ? 0x00 : FontByte(fdo))); }
+    static inline void GradColr(uint16_t fract, const uint8_t *c1, const uint8_t *c2, uint8_t *v)
+    {
+      for (int i=0; i<3; i++)
+      {
+        if (c1[i] <= c2[i])
+          v[i] = lerp16by16(c1[i]<<8, c2[i]<<8, fract) >> 8;
+        else
+          v[i] = lerp16by16(c2[i]<<8, c1[i]<<8, ~fract) >> 8;
+      }
+    }
+    // SetColrTable() converts the colours once into a CRGB per glyph/window row or column, rebuilt when they change
+    const struct CRGB *ColrTable(uint16_t Opt, const uint8_t *Col1, const uint8_t *Col2, uint8_t Rows, uint8_t XbpMax, int16_t Width, int16_t Height);
+    // The colour table holds CRGB, other pixel types (cLEDMatrixIndexed) keep being given each colour
+    static bool RGBPixel(struct CRGB &Pixel) { return(true); }
+    template <class tPixel> static bool RGBPixel(const tPixel &Pixel) { return(false); }
+    // A CRGB pixel takes the colour, any other (cLEDMatrixIndexed) only a COLR_INDEX palette index
+    static inline void PutColr(struct CRGB &Pixel, uint16_t Opt, const uint8_t *v)
+    {
+      if ((Opt & COLR_HSV) == COLR_RGB)
+        Pixel = CRGB(v[0], v[1], v[2]);
+      else
+        Pixel = CHSV(v[0], v[1], v[2]);
+    }
+    template <class tPixel> static inline void PutColr(tPixel Pixel, uint16_t Opt, const uint8_t *v)
+    {
+      if ((Opt & COLR_INDEX) == COLR_INDEX)
+        Pixel = v[0];
+    }
+    static inline void PutColr(struct CRGB &Pixel, const struct CRGB &Colr) { Pixel = Colr; }
+    template <class tPixel> static inline void PutColr(tPixel Pixel, const struct CRGB &Colr) {}
+    static inline void ErasePixel(struct CRGB &Pixel) { Pixel = CRGB(0, 0, 0); }
+    template <class tPixel> static inline void ErasePixel(tPixel Pixel) { Pixel = (uint8_t)0; }  // Palette entry 0 is the background
+    bool ShiftSafe(uint16_t Opt);
+    bool ShiftArea(int16_t Width, int16_t Height, int16_t &x0, int16_t &y0, int16_t &x1, int16_t &y1);
+    template <class tMatrix> void ShiftWindow(tMatrix &Matrix, int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+    static bool ShiftMatrix(cLEDMatrixBase &Matrix, uint16_t Scroll) { return(false); }
+    template <class tMatrix> static bool ShiftMatrix(tMatrix &Matrix, uint16_t Scroll)
+    {
+      if (Scroll == SCROLL_LEFT)
+        Matrix.ShiftLeft();
+      else if (Scroll == SCROLL_RIGHT)
+        Matrix.ShiftRight();
+      else if (Scroll == SCROLL_UP)
+        Matrix.ShiftUp();
+      else
+        Matrix.ShiftDown();
+      return(true);
+    }
 
     cLEDMatrixBase *m_Matrix;
     uint8_t m_FontWidth, m_FontHeight, m_FontBase, m_FontUpper, m_FWBytes, m_FCBytes;
     const uint8_t *m_FontData;
+    uint8_t *m_FontGlyph;
+    cGlyphSlot *m_FontSlot;
+    uint16_t m_FontSlotBytes;          // size of the m_FontSlot block, kept for the next font
+    uint8_t m_FontSlots, m_FontLast;
+    uint16_t m_FontClock, m_FIndex, m_FStream;
+    const uint8_t *m_FChars;
+    uint16_t m_FGlyphs, m_FLastCh;
+    int16_t m_FLastGlyph;
+    cTextCode *m_Code;
+    cGlyphSlot *m_GlyphSlot;
+    uint32_t *m_GlyphBits;
+    uint8_t m_GlyphSlots, m_GlyphCols;
+    uint16_t m_GlyphClock;
+    int16_t m_ShiftRows;
+    uint16_t m_LastScroll;
+    bool m_Incremental, m_ShiftSafe;
+    struct CRGB *m_ColrTable;
+    int16_t m_ColrSize, m_ColrCount;
+    uint16_t m_ColrOpt;
+    uint8_t m_ColrKey[6];
+    bool m_ColrTab;
+    uint16_t m_TickRate;
+    uint32_t m_TickInc, m_TickFract, m_TickTime;
+    cTextSource *m_Source, *m_NextSource;  // m_NextSource is read once m_Source has ended
+    unsigned char *m_Window;
+    uint16_t m_WinSize, m_WinFill;
+    bool m_SourceEnd;
     int16_t m_XMin, m_XMax, m_YMin, m_YMax;
-    unsigned char *m_pText;
+    const unsigned char *m_pText;
     uint16_t m_pSize, m_TextPos, m_Options, m_EOLtp;
     uint8_t m_XBitPos, m_YBitPos;
     uint8_t m_BackDim, m_ColDim, m_Col1[3], m_Col2[3], m_FrameRate;
-    uint16_t m_LastDelayTP, m_LastCustomRCTP, m_DelayCounter;
-    bool m_FProp, Initialised;
+    uint16_t m_LastDelayTP, m_LastCustomRCTP, m_DelayCounter, m_WalkDelay;
+    uint16_t m_MatrixChanges;
+    bool m_FProp, m_FPacked, m_FSparse, Initialised, m_Redraw;
 };
 
+
+// Statically dispatched variant for a known matrix type, pixel mapping and clipping get inlined.
+// Also takes matrices that are not a cLEDMatrixBase (cLEDMatrixIndexed), only this class can draw into those.
+template <class tMatrix>
+class cLEDTextDirect : public cLEDText
+{
+  private:
+    tMatrix *m_Direct;
+    static cLEDMatrixBase *AsBase(cLEDMatrixBase *Matrix) { return(Matrix); }
+    static cLEDMatrixBase *AsBase(void *Matrix) { return(NULL); }
+
+  public:
+    void Init(tMatrix *Matrix, uint16_t Width, uint16_t Height, int16_t OriginX = 0, int16_t OriginY = 0)
+    {
+      cLEDText::Init(AsBase(Matrix), Width, Height, OriginX, OriginY);
+      m_Direct = Matrix;
+    }
+    int UpdateText()
+    {
+      return(StepText(*m_Direct));
+    }
+};
+
+
+template <class tMatrix>
+int cLEDText::RenderText(tMatrix &Matrix)
+{
+  cTextFrame F;
+
+  // The text is stepped and walked in LEDText.cpp, only the columns to draw come back here
+  if (!BeginFrame(F, Matrix.ChangeCount(), Matrix.Width(), Matrix.Height(), RGBPixel(Matrix(0, 0))))
+    return(-1);
+  WalkText(F, Matrix.Width(), Matrix.Height(), &Matrix, DrawThunk<tMatrix>);
+  if ( (F.Changed || F.Dimmed) && (F.DirtyYMin <= F.DirtyYMax) )
+    Matrix.MarkDirty(m_XMin, F.DirtyYMin, m_XMax, F.DirtyYMax);
+  m_MatrixChanges = Matrix.ChangeCount();
+  return(EndFrame(F));
+}
+
+
+template <class tMatrix>
+void cLEDText::DrawColumn(tMatrix &Matrix, cTextFrame &F)
+{
+  // Copied out of F, a pixel write could otherwise alias it and force every read back to memory
+  const uint16_t opt = F.opt;
+  const int16_t x = F.x, MinY = F.MinY, MaxY = F.MaxY, cy0 = F.cy0, cy1 = F.cy1, cti = F.cti, ctr = F.ctr;
+  const uint8_t xbp = F.xbp, xgap = F.xgap, bDim = F.bDim, cDim = F.cDim;
+  const uint8_t *c1 = F.c1, *c2 = F.c2, *gb = F.gb;
+  const struct CRGB *ct = F.ct;
+  const bool Bits = F.Bits;
+  uint32_t cbits = F.cbits;
+  uint16_t fdo = F.fdo;
+  uint8_t bf = F.bf;
+  bool Dimmed = false;
+  int16_t y;
+
+  if ((F.Inc == INC_SHIFT) && (!F.Shifted))
+  {
+    ShiftWindow(Matrix, F.sx0, F.sy0, F.sx1, F.sy1);
+    F.Shifted = true;
+  }
+  y = MinY - 1;
+  while (y <= MaxY)
+  {
+    if ((y >= 0) && (y < Matrix.Height()) && (y >= cy0) && (y <= cy1))
+    {
+      if ( (xbp != xgap) && (y >= MinY) && (y < MaxY) && (Bits ? ((cbits & 1) != 0) : ((GlyphByte(gb, fdo) & bf) != 0x00)) )
+      {
+        if ((opt & COLR_MASK) != COLR_EMPTY)
+        {
+          if ((opt & COLR_MASK) == COLR_DIMMING)
+          {
+            Matrix(x, y).nscale8(cDim);
+            Dimmed = true;
+          }
+          else if (ct != NULL)
+            PutColr(Matrix(x, y), ct[cti + (y * ctr)]);
+          else
+          {
+            uint8_t v[3];
+            if ((opt & COLR_GRAD) == COLR_SINGLE)
+              memcpy(v, c1, sizeof(v));
+            else
+            {
+              uint16_t fract;
+              if ((opt & (COLR_AREA | COLR_HORI)) == (COLR_CHAR | COLR_VERT))
+                fract = (y - MinY) * F.MfractCV;
+              else if ((opt & (COLR_AREA | COLR_HORI)) == (COLR_AREA | COLR_VERT))
+                fract = (y - m_YMin) * F.MfractAV;
+              else if ((opt & (COLR_AREA | COLR_HORI)) == (COLR_CHAR | COLR_HORI))
+                fract = xbp * F.MfractCH;
+              else /* if ((opt & (COLR_AREA | COLR_HORI)) == (COLR_AREA | COLR_HORI)) */
+                fract = (x - m_XMin) * F.MfractAH;
+              GradColr(fract, c1, c2, v);
+            }
+            PutColr(Matrix(x, y), opt, v);
+          }
+        }
+      }
+      else if ( (((opt & SCROLL_MASK) == SCROLL_DOWN) && ( (MinY <= m_YMin) || (y >= MinY)))
+              || (((opt & SCROLL_MASK) != SCROLL_DOWN) && ( (MaxY >= m_YMax) || (y < MaxY))) )
+      // Fix for double dimming/blanking of blank vertical gap lines
+      {
+        if ((opt & BACKGND_MASK) == BACKGND_ERASE)
+          ErasePixel(Matrix(x, y));
+        else if ((opt & BACKGND_MASK) == BACKGND_DIMMING)
+        {
+          Matrix(x, y).nscale8(bDim);
+          Dimmed = true;
+        }
+      }
+    }
+    if ((y >= MinY) && (xbp != xgap))
+    {
+      if (Bits)
+        cbits >>= 1;
+      else
+        GlyphBitStep(opt, &fdo, &bf);
+    }
+    ++y;
+  }
+  if (Dimmed)
+    F.Dimmed = true;
+}
+
+
+template <class tMatrix>
+int cLEDText::StepText(tMatrix &Matrix)
+{
+  uint16_t Ticks;
+  int rc;
+
+  // With SetFrameClock() a frame is only rendered once the clock says one is due, frames missed
+  // in between are played without drawing so the text keeps its speed whatever the loop rate
+  if (m_TickRate != 0)
+  {
+    if (Initialised == true)
+      ClockRestart();  // The first frame is drawn straight away and starts the clock
+    else
+    {
+      Ticks = ClockTicks();
+      if (Ticks == 0)
+      {
+        if ( (m_Redraw) || (Matrix.ChangeCount() != m_MatrixChanges) )
+          RedrawText(Matrix);
+        return(0);
+      }
+      if ( (Ticks > 1) && ((rc = SkipFrames(Ticks - 1)) != 0) )
+        return(rc);
+    }
+  }
+  if (m_Source != NULL)
+    FillText();
+  return(RenderText(Matrix));
+}
+
+
+template <class tMatrix>
+void cLEDText::RedrawText(tMatrix &Matrix)
+{
+  uint16_t DelayCounter = m_DelayCounter, LastDelayTP = m_LastDelayTP, LastCustomRCTP = m_LastCustomRCTP;
+
+  // Nothing drawn yet, the next frame draws the start anyway
+  if (Initialised == true)
+    return;
+  // Draws the last frame again without stepping the text, codes in the window are undone afterwards.
+  // The walk stops at a running delay code, so it needs the count the last walk ended with.
+  m_EOLtp = m_TextPos;
+  m_DelayCounter = m_WalkDelay;
+  Initialised = m_Redraw = true;
+  RenderText(Matrix);
+  Initialised = false;
+  m_DelayCounter = DelayCounter;
+  m_LastDelayTP = LastDelayTP;
+  m_LastCustomRCTP = LastCustomRCTP;
+}
+
+
+template <class tMatrix>
+void cLEDText::ShiftWindow(tMatrix &Matrix, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  uint16_t Scroll = m_Options & SCROLL_MASK;
+  int16_t x, y;
+
+  // The matrix shifts are much quicker, in viewport mode they only move the origin
+  if ( (x0 == 0) && (y0 == 0) && (x1 == (Matrix.Width() - 1)) && (y1 == (Matrix.Height() - 1)) && (ShiftMatrix(Matrix, Scroll)) )
+    return;
+  if (Scroll == SCROLL_LEFT)
+  {
+    for (y=y0; y<=y1; ++y)
+      for (x=x0; x<x1; ++x)
+        Matrix(x, y) = Matrix(x + 1, y);
+  }
+  else if (Scroll == SCROLL_RIGHT)
+  {
+    for (y=y0; y<=y1; ++y)
+      for (x=x1; x>x0; --x)
+        Matrix(x, y) = Matrix(x - 1, y);
+  }
+  else if (Scroll == SCROLL_UP)
+  {
+    for (y=y1; y>y0; --y)
+      for (x=x0; x<=x1; ++x)
+        Matrix(x, y) = Matrix(x, y - 1);
+  }
+  else
+  {
+    for (y=y0; y<y1; ++y)
+      for (x=x0; x<=x1; ++x)
+        Matrix(x, y) = Matrix(x, y + 1);
+  }
+  Matrix.MarkDirty(x0, y0, x1, y1);
+}
+
 #endif
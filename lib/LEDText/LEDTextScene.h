@@ -0,0 +1,160 @@
+/*
+  Text scene for cLEDText
+
+  Several text zones share one matrix, each with its own window and frame rate.
+  Zones are drawn in the order they are added, so a later zone is on top where
+  windows overlap. Update() draws every zone in one pass with static dispatch,
+  like cLEDTextDirect. A zone is only drawn when its frame is due. A zone that
+  is not due is drawn again only when a zone below it covered part of its window.
+*/
+
+#ifndef LEDTextScene_h
+#define LEDTextScene_h
+
+#include <LEDMatrix.h>
+#include <LEDText.h>
+
+#define SCENE_ZONES_MAX  4
+#define SCENE_HOLD       0xff    // Zone rate, only drawn after SetText(), the text is never stepped
+
+template <class tMatrix>
+class cLEDTextScene
+{
+private:
+  struct cZone
+  {
+    cLEDText *Text;
+    int16_t x0, y0, x1, y1;     // Window clipped to the matrix
+    uint8_t Rate, Count;        // Drawn every Rate + 1 scene frames, Count frames to go
+    bool Visible, Dirty;        // Dirty: pixels were lost, draw it again even if not due
+    int RC;
+  };
+  tMatrix *m_Matrix;
+  cZone m_Zone[SCENE_ZONES_MAX];
+  uint8_t m_Zones;
+  uint16_t m_Changes;           // Matrix ChangeCount() after the last Update()
+
+  static cLEDMatrixBase *AsBase(cLEDMatrixBase *Matrix) { return (Matrix); }
+  static cLEDMatrixBase *AsBase(void *Matrix) { return (NULL); }
+  bool Overlap(uint8_t a, uint8_t b)
+  {
+    return ((m_Zone[a].x0 <= m_Zone[b].x1) && (m_Zone[b].x0 <= m_Zone[a].x1) && (m_Zone[a].y0 <= m_Zone[b].y1) && (m_Zone[b].y0 <= m_Zone[a].y1));
+  }
+
+public:
+  cLEDTextScene(tMatrix *pMatrix)
+  {
+    m_Matrix = pMatrix;
+    m_Zones = 0;
+    m_Changes = pMatrix->ChangeCount();
+  }
+
+  // Init()s the text for the scene matrix, returns the zone number or -1 if the scene is full
+  int8_t AddZone(cLEDText *pText, uint16_t Width, uint16_t Height, int16_t OriginX = 0, int16_t OriginY = 0, uint8_t Rate = 0)
+  {
+    if (m_Zones >= SCENE_ZONES_MAX)
+      return (-1);
+    cZone &z = m_Zone[m_Zones];
+    pText->Init(AsBase(m_Matrix), Width, Height, OriginX, OriginY);
+    z.Text = pText;
+    z.x0 = max(OriginX, (int16_t)0);
+    z.y0 = max(OriginY, (int16_t)0);
+    z.x1 = min((int16_t)(OriginX + Width - 1), (int16_t)(m_Matrix->Width() - 1));
+    z.y1 = min((int16_t)(OriginY + Height - 1), (int16_t)(m_Matrix->Height() - 1));
+    z.Rate = Rate;
+    z.Count = 0;
+    z.Visible = true;
+    z.Dirty = false;
+    z.RC = 0;
+    return (m_Zones++);
+  }
+  uint8_t Zones() { return (m_Zones); }
+
+  void SetRate(uint8_t Zone, uint8_t Rate)
+  {
+    if (Zone < m_Zones)
+    {
+      m_Zone[Zone].Rate = Rate;
+      m_Zone[Zone].Count = 0;
+    }
+  }
+  // A hidden zone is not stepped, its window is cleared and the zones it overlaps are drawn again
+  void SetVisible(uint8_t Zone, bool Visible)
+  {
+    if ((Zone >= m_Zones) || (m_Zone[Zone].Visible == Visible))
+      return;
+    cZone &z = m_Zone[Zone];
+    z.Visible = Visible;
+    z.Dirty = Visible;
+    if (Visible)
+    {
+      z.Text->ClockRestart();   // A SetFrameClock() text carries on where it was hidden
+      return;
+    }
+    if ((z.x0 <= z.x1) && (z.y0 <= z.y1))
+    {
+      for (int16_t y = z.y0; y <= z.y1; ++y)
+      {
+        for (int16_t x = z.x0; x <= z.x1; ++x)
+          cLEDText::ErasePixel((*m_Matrix)(x, y));
+      }
+      m_Matrix->MarkDirty(z.x0, z.y0, z.x1, z.y1);
+      m_Changes = m_Matrix->ChangeCount();
+    }
+    for (uint8_t l = 0; l < m_Zones; ++l)
+    {
+      if ((l != Zone) && (Overlap(l, Zone)))
+        m_Zone[l].Dirty = true;
+    }
+  }
+  bool Visible(uint8_t Zone) { return ((Zone < m_Zones) && (m_Zone[Zone].Visible)); }
+
+  // What the zone's UpdateText() returned in the last Update(), 0 if it was not due
+  int RC(uint8_t Zone) { return ((Zone < m_Zones) ? m_Zone[Zone].RC : 0); }
+
+  // Draws the zones that are due and those whose pixels were lost, returns false if none were drawn
+  bool Update()
+  {
+    bool Drawn[SCENE_ZONES_MAX];
+    bool External, Any = false;
+    uint8_t l, b;
+
+    // Someone else drew on the matrix, every zone starts again from a full redraw
+    External = (m_Matrix->ChangeCount() != m_Changes);
+    for (l = 0; l < m_Zones; ++l)
+    {
+      cZone &z = m_Zone[l];
+      bool Due, Hit;
+      Drawn[l] = false;
+      z.RC = 0;
+      if (!z.Visible)
+        continue;
+      if (z.Rate == SCENE_HOLD)
+        Due = z.Text->Initialised;
+      else
+        Due = (z.Count == 0);
+      Hit = (External || z.Dirty);
+      for (b = 0; (b < l) && (!Hit); ++b)
+        Hit = ((Drawn[b]) && (Overlap(b, l)));
+      if ((Due) || (Hit))
+      {
+        // Zones sharing the matrix always change its count, only the scene knows what really changed
+        z.Text->m_MatrixChanges = m_Matrix->ChangeCount();
+        if (Hit)
+          z.Text->m_Redraw = true;
+        if (Due)
+          z.RC = z.Text->StepText(*m_Matrix);
+        else
+          z.Text->RedrawText(*m_Matrix);
+        Drawn[l] = Any = true;
+        z.Dirty = false;
+      }
+      if (z.Rate != SCENE_HOLD)
+        z.Count = (z.Count == 0) ? z.Rate : (z.Count - 1);
+    }
+    m_Changes = m_Matrix->ChangeCount();
+    return (Any);
+  }
+};
+
+#endif
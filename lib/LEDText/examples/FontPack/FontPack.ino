@@ -0,0 +1,234 @@
+#include <FastLED.h>
+
+#include <LEDMatrix.h>
+#include <LEDText.h>
+#include <ComicSansP24.h>
+
+// Prints a packed copy of a font header over Serial, paste it into a new .h file.
+// cLEDText::SetFont() takes packed fonts as they are, glyphs are unpacked into a
+// few RAM slots when they are drawn. Change the two defines to pack another font.
+// Packing pays off for proportional fonts and fonts with blank rows, a font with
+// every pixel of every glyph in use comes out larger.
+//
+// Packed layout after the usual 4 header bytes (FONT_PACKED set in the height):
+//   widths         one per character, proportional fonts only
+//   offsets        characters + 1 little endian words, start of each glyph stream
+//   glyph streams  first row, row count, then the rows at the glyph width as one
+//                  MSB first bit string. Blank rows above and below are left out,
+//                  a blank glyph has an empty stream.
+//
+// Define FONT_CHARS to keep only those characters. The font then also gets FONT_SPARSE
+// and, straight after the header, the glyph count - 1 and its characters in ascending
+// order, which SetFont() binary searches. The character range stays that of the full
+// font, the characters left out are drawn with the lowest one kept, so list a space.
+
+#define FONT_DATA   ComicSansP24Data
+#define FONT_NAME   "ComicSansP24"
+// #define FONT_CHARS  " 0123456789:.-"
+
+#define MAX_GLYPH   512   // Largest bitmap in bytes, width bytes * height
+
+uint8_t Width, Height, First, Last, WBytes;
+bool Prop;
+uint16_t Size, CBytes;
+uint8_t Codes[256];
+uint16_t Chars;
+
+uint8_t FontByte(uint16_t Offset)
+{
+  return (pgm_read_byte(&FONT_DATA[Offset]));
+}
+
+bool RowBlank(uint16_t Base, uint8_t y, uint8_t GWidth)
+{
+  for (uint8_t x = 0; x < GWidth; ++x)
+  {
+    if (FontByte(Base + (y * WBytes) + (x / 8)) & (0x80 >> (x % 8)))
+      return (false);
+  }
+  return (true);
+}
+
+// Packs the bitmap of one glyph, returns the stream length, Out may be NULL to only measure it
+uint16_t PackGlyph(uint8_t Ch, uint8_t *Out)
+{
+  uint16_t Base = 4 + ((Ch - First) * CBytes);
+  uint8_t GWidth = Width, Top = 0, Bottom = Height;
+  uint16_t n = 2;
+  uint8_t Acc = 0, Bits = 0;
+
+  if (Prop)
+    GWidth = FontByte(Base++);
+  while ((Top < Height) && (RowBlank(Base, Top, GWidth)))
+    ++Top;
+  while ((Bottom > Top) && (RowBlank(Base, Bottom - 1, GWidth)))
+    --Bottom;
+  if (Top == Bottom)
+    return (0);
+  if (Out != NULL)
+  {
+    Out[0] = Top;
+    Out[1] = Bottom - Top;
+  }
+  for (uint8_t y = Top; y < Bottom; ++y)
+  {
+    for (uint8_t x = 0; x < GWidth; ++x)
+    {
+      Acc = (Acc << 1) | ((FontByte(Base + (y * WBytes) + (x / 8)) >> (7 - (x % 8))) & 1);
+      if (++Bits == 8)
+      {
+        if (Out != NULL)
+          Out[n] = Acc;
+        ++n;
+        Acc = Bits = 0;
+      }
+    }
+  }
+  if (Bits > 0)
+  {
+    if (Out != NULL)
+      Out[n] = Acc << (8 - Bits);
+    ++n;
+  }
+  return (n);
+}
+
+void PrintHex(uint8_t b)
+{
+  Serial.print("0x");
+  if (b < 0x10)
+    Serial.print("0");
+  Serial.print(b, HEX);
+  Serial.print(",");
+}
+
+void setup()
+{
+  uint8_t Stream[MAX_GLYPH + 2];
+  uint16_t Offset = 0;
+
+  Serial.begin(115200);
+  delay(1000);
+  Width = FontByte(0);
+  Height = FontByte(1);
+  First = FontByte(2);
+  Last = FontByte(3);
+  Prop = ((Width & FONT_PROPORTIONAL) == FONT_PROPORTIONAL);
+  Width &= 0x7f;
+  WBytes = (Width + 7) / 8;
+  Size = WBytes * Height;
+  CBytes = Size + (Prop ? 1 : 0);
+  if ((Height & (FONT_PACKED | FONT_SPARSE)) || (Size > MAX_GLYPH))
+  {
+    Serial.println("Font already packed or glyphs larger than MAX_GLYPH");
+    return;
+  }
+  Chars = 0;
+  for (uint16_t ch = First; ch <= Last; ++ch)
+  {
+#ifdef FONT_CHARS
+    if (strchr(FONT_CHARS, ch) == NULL)
+      continue;
+#endif
+    Codes[Chars++] = ch;
+  }
+  if (Chars == 0)
+  {
+    Serial.println("None of FONT_CHARS are in the font");
+    return;
+  }
+
+  Serial.println("#ifndef " FONT_NAME "Pack_h");
+  Serial.println("#define " FONT_NAME "Pack_h");
+  Serial.println();
+  for (uint16_t c = 0; c < Chars; ++c)
+    Offset += PackGlyph(Codes[c], NULL);
+  Serial.print("// " FONT_NAME ".h packed by the FontPack example, ");
+  Serial.print(4 + (((Last - First) + 1) * CBytes));
+  Serial.print(" bytes down to ");
+#ifdef FONT_CHARS
+  Serial.println(5 + Chars + (Prop ? Chars : 0) + ((Chars + 1) * 2) + Offset);
+#else
+  Serial.println(4 + (Prop ? Chars : 0) + ((Chars + 1) * 2) + Offset);
+#endif
+  Offset = 0;
+  Serial.println("const uint8_t " FONT_NAME "PackData[] PROGMEM = {");
+  Serial.print("\t\t\t");
+  if (Prop)
+    Serial.print("FONT_PROPORTIONAL | ");
+  Serial.print(Width);
+  Serial.println(",  // Font Width");
+#ifdef FONT_CHARS
+  Serial.print("\t\t\tFONT_PACKED | FONT_SPARSE | ");
+#else
+  Serial.print("\t\t\tFONT_PACKED | ");
+#endif
+  Serial.print(Height);
+  Serial.println(",  // Font Height");
+  Serial.print("\t\t\t");
+  Serial.print(First);
+  Serial.println(", // Font First Character");
+  Serial.print("\t\t\t");
+  Serial.print(Last);
+  Serial.println(",// Font Last Character");
+#ifdef FONT_CHARS
+  Serial.print("\t\t\t");
+  Serial.print(Chars - 1);
+  Serial.println(",  // Glyphs - 1");
+  for (uint16_t c = 0; c < Chars; ++c)
+  {
+    if ((c % 16) == 0)
+      Serial.print("\t\t\t");
+    Serial.print(Codes[c]);
+    Serial.print(",");
+    if (((c % 16) == 15) || (c == (Chars - 1)))
+      Serial.println(c == (Chars - 1) ? "  // Characters" : "");
+  }
+#endif
+  if (Prop)
+  {
+    for (uint16_t c = 0; c < Chars; ++c)
+    {
+      if ((c % 16) == 0)
+        Serial.print("\t\t\t");
+      Serial.print(FontByte(4 + ((Codes[c] - First) * CBytes)));
+      Serial.print(",");
+      if (((c % 16) == 15) || (c == (Chars - 1)))
+        Serial.println(c == (Chars - 1) ? "  // Glyph widths" : "");
+    }
+  }
+  for (uint16_t c = 0; c <= Chars; ++c)
+  {
+    if ((c % 16) == 0)
+      Serial.print("\t\t\t");
+    PrintHex(Offset & 0xff);
+    PrintHex(Offset >> 8);
+    if (c < Chars)
+      Offset += PackGlyph(Codes[c], NULL);
+    if (((c % 16) == 15) || (c == Chars))
+      Serial.println(c == Chars ? "  // Glyph offsets" : "");
+  }
+  for (uint16_t c = 0; c < Chars; ++c)
+  {
+    uint16_t n = PackGlyph(Codes[c], Stream);
+    Serial.print("\t\t\t");
+    for (uint16_t i = 0; i < n; ++i)
+      PrintHex(Stream[i]);
+    Serial.print("  // ");
+    if ((Codes[c] > ' ') && (Codes[c] < 0x7f) && (Codes[c] != '\\'))
+      Serial.println((char)Codes[c]);
+    else
+    {
+      Serial.print("0x");
+      Serial.println(Codes[c], HEX);
+    }
+  }
+  Serial.println("};");
+  Serial.println();
+  Serial.println("#endif");
+}
+
+
+void loop()
+{
+}
@@ -0,0 +1,104 @@
+#include <FastLED.h>
+
+#include <LEDMatrix.h>
+#include <LEDText.h>
+#include <Font12x16.h>
+
+// Scrolls the same message in each colour mode with and without SetColrTable()
+// and prints the UpdateText() time in CPU cycles per lit pixel. The whole frame is
+// timed, so the figures also carry the glyph walk and background erase.
+// FastLED.show() is never called so no LEDs need to be connected.
+
+#define MATRIX_WIDTH   64
+#define MATRIX_HEIGHT  24
+#define MATRIX_TYPE    HORIZONTAL_MATRIX
+
+#define PASSES         2
+
+cLEDMatrix<MATRIX_WIDTH, MATRIX_HEIGHT, MATRIX_TYPE> leds;
+
+cLEDTextDirect<cLEDMatrix<MATRIX_WIDTH, MATRIX_HEIGHT, MATRIX_TYPE> > ScrollingMsg;
+
+#define BENCH_TEXT     "     THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 0123456789     "
+
+const unsigned char TxtRGB[] = { EFFECT_SCROLL_LEFT EFFECT_RGB "\x00\x80\xff" BENCH_TEXT };
+const unsigned char TxtHSV[] = { EFFECT_SCROLL_LEFT EFFECT_HSV "\x60\xff\xff" BENCH_TEXT };
+const unsigned char TxtHSV_CV[] = { EFFECT_SCROLL_LEFT EFFECT_HSV_CV "\x00\xff\xff\x40\xff\xff" BENCH_TEXT };
+const unsigned char TxtHSV_CH[] = { EFFECT_SCROLL_LEFT EFFECT_HSV_CH "\x00\xff\xff\x40\xff\xff" BENCH_TEXT };
+const unsigned char TxtHSV_AV[] = { EFFECT_SCROLL_LEFT EFFECT_HSV_AV "\x00\xff\xff\x40\xff\xff" BENCH_TEXT };
+const unsigned char TxtHSV_AH[] = { EFFECT_SCROLL_LEFT EFFECT_HSV_AH "\x00\xff\xff\xff\xff\xff" BENCH_TEXT };
+const unsigned char TxtRGB_AH[] = { EFFECT_SCROLL_LEFT EFFECT_RGB_AH "\x10\x20\x30\xf0\xe0\xd0" BENCH_TEXT };
+
+// Lit pixels over the whole scroll, counted on a separate untimed run
+uint32_t LitPixels(const unsigned char *Txt, uint16_t TxtSize)
+{
+  uint32_t Lit = 0;
+
+  ScrollingMsg.Init(&leds, leds.Width(), ScrollingMsg.FontHeight() + 1, 0, 0);
+  ScrollingMsg.SetText((unsigned char *)Txt, TxtSize);
+  while (ScrollingMsg.UpdateText() != -1)
+  {
+    for (int16_t y = 0; y < leds.Height(); ++y)
+    {
+      for (int16_t x = 0; x < leds.Width(); ++x)
+      {
+        if (leds(x, y))
+          ++Lit;
+      }
+    }
+  }
+  return (max(Lit, (uint32_t)1));
+}
+
+uint32_t Bench(const unsigned char *Txt, uint16_t TxtSize, bool Table)
+{
+  ScrollingMsg.Init(&leds, leds.Width(), ScrollingMsg.FontHeight() + 1, 0, 0);
+  ScrollingMsg.SetColrTable(Table);
+  uint32_t t = micros();
+  for (uint8_t p = 0; p < PASSES; ++p)
+  {
+    ScrollingMsg.SetText((unsigned char *)Txt, TxtSize);
+    while (ScrollingMsg.UpdateText() != -1)
+      ;
+  }
+  return (micros() - t);
+}
+
+void Report(const char *Name, const unsigned char *Txt, uint16_t TxtSize)
+{
+  uint32_t Lit = LitPixels(Txt, TxtSize) * PASSES;
+
+  Serial.print(Name);
+  Serial.print("  per pixel ");
+  Serial.print((float)Bench(Txt, TxtSize, false) * (F_CPU / 1000000) / Lit, 1);
+  Serial.print(" cycles/lit pixel  table ");
+  Serial.print((float)Bench(Txt, TxtSize, true) * (F_CPU / 1000000) / Lit, 1);
+  Serial.println(" cycles/lit pixel");
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+  Serial.print(MATRIX_WIDTH);
+  Serial.print("x");
+  Serial.print(MATRIX_HEIGHT);
+  Serial.print(" at ");
+  Serial.print(F_CPU / 1000000);
+  Serial.println("MHz");
+
+  ScrollingMsg.SetFont(Font12x16Data);
+  Report("RGB    ", TxtRGB, sizeof(TxtRGB) - 1);
+  Report("HSV    ", TxtHSV, sizeof(TxtHSV) - 1);
+  Report("HSV_CV ", TxtHSV_CV, sizeof(TxtHSV_CV) - 1);
+  Report("HSV_CH ", TxtHSV_CH, sizeof(TxtHSV_CH) - 1);
+  Report("HSV_AV ", TxtHSV_AV, sizeof(TxtHSV_AV) - 1);
+  Report("HSV_AH ", TxtHSV_AH, sizeof(TxtHSV_AH) - 1);
+  Report("RGB_AH ", TxtRGB_AH, sizeof(TxtRGB_AH) - 1);
+  ScrollingMsg.SetColrTable(false);
+}
+
+
+void loop()
+{
+}
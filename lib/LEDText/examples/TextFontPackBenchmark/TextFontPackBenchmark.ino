@@ -0,0 +1,97 @@
+#include <FastLED.h>
+
+#include <LEDMatrix.h>
+#include <LEDText.h>
+#include <ComicSansP24.h>
+#include <ComicSansP24Pack.h>
+#include <FontP16x16.h>
+#include <FontP16x16Pack.h>
+
+// Compares each bundled font with its packed copy (see the FontPack example):
+// flash size, time to fetch one glyph bitmap into RAM and the average UpdateText()
+// time while scrolling. FastLED.show() is never called so no LEDs need to be connected.
+
+#define MATRIX_WIDTH   64
+#define MATRIX_HEIGHT  24
+#define MATRIX_TYPE    HORIZONTAL_MATRIX
+
+#define FETCHES        2000
+
+cLEDMatrix<MATRIX_WIDTH, MATRIX_HEIGHT, MATRIX_TYPE> leds;
+
+// Opens up the glyph fetch, every character in turn misses the few RAM slots
+class cLEDTextBench : public cLEDTextDirect<cLEDMatrix<MATRIX_WIDTH, MATRIX_HEIGHT, MATRIX_TYPE> >
+{
+  public:
+    using cLEDText::FetchGlyph;
+    uint8_t FontBase() { return (m_FontBase); }
+    uint8_t FontUpper() { return (m_FontUpper); }
+};
+
+cLEDTextBench ScrollingMsg;
+
+const unsigned char TxtBench[] = { EFFECT_SCROLL_LEFT EFFECT_RGB "\x00\x80\xff" "     THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 0123456789     " };
+
+uint32_t Frames;
+
+// Nanoseconds per glyph
+uint32_t Fetch(const uint8_t *Font)
+{
+  ScrollingMsg.SetFont(Font);
+  uint8_t Ch = ScrollingMsg.FontBase();
+  uint32_t t = micros();
+  for (uint16_t i = 0; i < FETCHES; ++i)
+  {
+    ScrollingMsg.FetchGlyph(Ch);
+    if (++Ch > ScrollingMsg.FontUpper())
+      Ch = ScrollingMsg.FontBase();
+  }
+  return (((micros() - t) * 1000) / FETCHES);
+}
+
+uint32_t Scroll(const uint8_t *Font, uint8_t Glyphs)
+{
+  ScrollingMsg.SetFont(Font);
+  ScrollingMsg.Init(&leds, leds.Width(), ScrollingMsg.FontHeight() + 1, 0, 0);
+  ScrollingMsg.SetGlyphCache(Glyphs);
+  ScrollingMsg.SetText((unsigned char *)TxtBench, sizeof(TxtBench) - 1);
+  Frames = 0;
+  uint32_t t = micros();
+  while (ScrollingMsg.UpdateText() != -1)
+    ++Frames;
+  ScrollingMsg.SetGlyphCache(0);
+  return ((micros() - t) / Frames);
+}
+
+void Report(const char *Name, const uint8_t *Font, uint16_t Size)
+{
+  Serial.print(Name);
+  Serial.print(Size);
+  Serial.print(" bytes  fetch ");
+  Serial.print(Fetch(Font));
+  Serial.print("ns/glyph  scroll ");
+  Serial.print(Scroll(Font, 0));
+  Serial.print("us/frame, with SetGlyphCache(16) ");
+  Serial.print(Scroll(Font, 16));
+  Serial.println("us/frame");
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+  Serial.print(MATRIX_WIDTH);
+  Serial.print(" wide, ");
+  Serial.print(FONT_PACKED_GLYPHS);
+  Serial.println(" unpacked glyphs in RAM");
+
+  Report("ComicSansP24      ", ComicSansP24Data, sizeof(ComicSansP24Data));
+  Report("ComicSansP24Pack  ", ComicSansP24PackData, sizeof(ComicSansP24PackData));
+  Report("FontP16x16        ", FontP16x16Data, sizeof(FontP16x16Data));
+  Report("FontP16x16Pack    ", FontP16x16PackData, sizeof(FontP16x16PackData));
+}
+
+
+void loop()
+{
+}
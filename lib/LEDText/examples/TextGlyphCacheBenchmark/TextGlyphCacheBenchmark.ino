@@ -0,0 +1,81 @@
+#include <FastLED.h>
+
+#include <LEDMatrix.h>
+#include <LEDText.h>
+#include <FontMatrise.h>
+#include <Font12x16.h>
+#include <ComicSansP24.h>
+// FontRobert.h comes with the message board sketch, copy it next to this one to include it
+#if __has_include("FontRobert.h")
+  #include "FontRobert.h"
+#endif
+
+// Scrolls the same message through each font with and without SetGlyphCache()
+// and prints the average UpdateText() time. Only the text rendering is timed,
+// FastLED.show() is never called so no LEDs need to be connected.
+
+#define MATRIX_WIDTH   64
+#define MATRIX_HEIGHT  24
+#define MATRIX_TYPE    HORIZONTAL_MATRIX
+
+#define CACHE_GLYPHS   16
+#define PASSES         2
+
+cLEDMatrix<MATRIX_WIDTH, MATRIX_HEIGHT, MATRIX_TYPE> leds;
+
+cLEDTextDirect<cLEDMatrix<MATRIX_WIDTH, MATRIX_HEIGHT, MATRIX_TYPE> > ScrollingMsg;
+
+const unsigned char TxtBench[] = { EFFECT_SCROLL_LEFT EFFECT_RGB "\x00\x80\xff" "     THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 0123456789     " };
+
+uint32_t Frames;
+
+uint32_t Bench(const uint8_t *Font, uint8_t Glyphs)
+{
+  ScrollingMsg.SetFont(Font);
+  ScrollingMsg.Init(&leds, leds.Width(), ScrollingMsg.FontHeight() + 1, 0, 0);
+  ScrollingMsg.SetGlyphCache(Glyphs);
+  Frames = 0;
+  uint32_t t = micros();
+  for (uint8_t p = 0; p < PASSES; ++p)
+  {
+    ScrollingMsg.SetText((unsigned char *)TxtBench, sizeof(TxtBench) - 1);
+    while (ScrollingMsg.UpdateText() != -1)
+      ++Frames;
+  }
+  return ((micros() - t) / Frames);
+}
+
+void Report(const char *Name, const uint8_t *Font)
+{
+  Serial.print(Name);
+  Serial.print("  plain ");
+  Serial.print(Bench(Font, 0));
+  Serial.print("us/frame  cached ");
+  Serial.print(Bench(Font, CACHE_GLYPHS));
+  Serial.print("us/frame  (");
+  Serial.print(Frames);
+  Serial.println(" frames)");
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(1000);
+  Serial.print(MATRIX_WIDTH);
+  Serial.print(" wide, ");
+  Serial.print(CACHE_GLYPHS);
+  Serial.println(" cached glyphs");
+
+#if __has_include("FontRobert.h")
+  Report("Robert      ", RobertFontData);
+#endif
+  Report("Matrise     ", MatriseFontData);
+  Report("12x16       ", Font12x16Data);
+  Report("ComicSansP24", ComicSansP24Data);
+  ScrollingMsg.SetGlyphCache(0);
+}
+
+
+void loop()
+{
+}
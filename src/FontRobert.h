@@ -1,7 +1,7 @@
 #ifndef FontRobert_h
 #define FontRobert_h
 
-const uint8_t RobertFontData[] = {
+const uint8_t RobertFontData[] PROGMEM = {
         5,  // Font Width
         8,  // Font Height
         32, // Font First Character
@@ -46,6 +46,7 @@
 #include <FastLED.h>
 #include <LEDMatrix.h>
 #include <LEDText.h>
+#include <LEDTextScene.h>
 #include "FontRobert.h"                     // for 5x7 font use <FontMatriseRW.h>
 
 #include <Wire.h>
@@ -69,12 +70,17 @@ Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 
 //#define LED_BUILTIN 26
 #define LED_PIN     7                       // * for ESP32 use 27
+#define LED_SEGMENTS 1                      // >1 splits the panels over GPIO12.. (WS2811_PORTA), clocked out in parallel
 #define VOLTS       5
 #define MAX_MA      400
+#define LED_GAMMA   2.2                     // output LUT gamma, the LUT dithers as FastLED's dither is off at brightness 255
+#define DITHER_MS   33                      // unchanged frames are resent for the dither at most this often, the scroll rate
 
 #define MATRIX_WIDTH  -32
 #define MATRIX_HEIGHT -8
 #define MATRIX_TYPE VERTICAL_MATRIX
+#define SCROLL_FPS  30                      // scroll frames per second, whatever the loop() rate
+#define MSG_LOOKAHEAD  64                   // bytes of the message ScrollingMsg holds, grown if a frame needs more
 
 #define  EFF_CHAR_UP          0xd8          // in sprintf change EFFECT_CHAR_UP to EFF_CHAR_UP in loop
 #define  EFF_CHAR_DOWN        0xd9
@@ -108,6 +114,7 @@ Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
 #define  EFF_CUSTOM_RC        0xfa
 
 int BRIGHTNESS = 30;
+int lutBrightness;                          // brightness the output LUT was built for
 
 int rc;                                     // custom return char for ledMatrix lib
 
@@ -130,20 +137,34 @@ char szTime[15];                             // hh:mm\0  "Time: %02d:%02d"
 char szDate[15];                             //          "Date: 01/01/22"
 char daysOfTheWeek[7][4] = {"SUN", "MON", "TUE", "WED", "THU", "FRI", "SAT"};
 
-char curMessage[BUF_SIZE] = "Vostro";
 char newMessage[BUF_SIZE] = "Vostro";
 char newTime[17] = "01.01.2022 12:00";
 bool newMessageAvailable = true;
 bool newTimeAvailable = false;
 
-cLEDMatrix<MATRIX_WIDTH, MATRIX_HEIGHT, MATRIX_TYPE> leds;
-cLEDText ScrollingMsg, StaticgMsg, RTCErrorMessage;
+typedef cLEDMatrix<MATRIX_WIDTH, MATRIX_HEIGHT, MATRIX_TYPE> cMatrix;
+cMatrix leds;                               // handed to FastLED
+cLEDTextScene<cMatrix> scene(&leds);        // zone 0 scrolls the message, zone 1 holds the date in its place
+cLEDText ScrollingMsg, StaticgMsg;          // drawn by the scene, inlined pixel mapping for our matrix
+cLEDTextDirect<cMatrix> RTCErrorMessage;
 
 CRGB fleds[256];
+CRGB ledFrame[256];                         // leds output, gamma, correction, brightness and dither applied by the output LUT
 
 char txtDateA[] = { EFFECT_HSV_AH "\x00\xff\xff\xff\xff\xff" "12|30" };
 char txtDateB[] = { EFFECT_HSV_AH "\x00\xff\xff\xff\xff\xff" "12:30" };
-char szMesg[BUF_SIZE] = { EFFECT_FRAME_RATE "\x00" EFFECT_HSV_AH "\x00\xff\xff\xff\xff\xff" EFFECT_SCROLL_LEFT "     ESP32 MESSAGE BOARD BY R WILSON     "  EFFECT_CUSTOM_RC "\x01" };
+const unsigned char szWelcome[] = { EFFECT_FRAME_RATE "\x00" EFFECT_HSV_AH "\x00\xff\xff\xff\xff\xff" EFFECT_SCROLL_LEFT "     ESP32 MESSAGE BOARD BY R WILSON     "  EFFECT_CUSTOM_RC "\x01" };
+// The message is streamed from a bank, the next pass is composed in the other one and queued
+struct cMsgBank
+{
+  char Head[128];                           // time, temperature, day and date
+  char Message[BUF_SIZE];
+  cTextSegments Source;                     // Head, Message, szTail
+};
+cMsgBank msgBank[2];
+uint8_t msgLatest = 0;                      // bank with the last message composed
+bool msgStale = false;                      // the queued pass shows an old time or message
+const unsigned char szTail[] = { "     " EFFECT_FRAME_RATE "\x00" };  // no end code, each pass runs into the next
 
 String handleTimeUpdate(uint8_t *data, size_t len){
   data[len] = '\0';
@@ -267,20 +288,30 @@ void rtcErrorHandler(){
 
   while(1) {
     if(RTCErrorMessage.UpdateText() != 0x99) {
-      FastLED.show();
+      leds.Show();
       delay(30);
     }
     else {
       RTCErrorMessage.SetText((unsigned char *)txtRTCError, sizeof(txtRTCError) - 1);
       RTCErrorMessage.UpdateText();
-      FastLED.show();
+      leds.Show();
     }
   }
 }
 
+CLEDController &addMatrixLeds()
+{
+#if LED_SEGMENTS > 1
+  return FastLED.addLeds<WS2811_PORTA, LED_SEGMENTS, GRB>(leds.Segment(0, LED_SEGMENTS), leds.SegmentSize(LED_SEGMENTS)).setCorrection(UncorrectedColor);
+#else
+  return FastLED.addLeds<WS2812B, LED_PIN, GRB>(leds.OutputArray(), leds.Size()).setCorrection(UncorrectedColor);
+#endif
+}
+
 void fxSinlon() //* Startup effects
 {
-  FastLED.addLeds<WS2812B,LED_PIN,GRB>(fleds, 250).setCorrection(TypicalLEDStrip);  //std fastled for effects
+  leds.LendController(fleds, leds.Size() / LED_SEGMENTS);  // effects buffer on the one matrix controller
+  leds.Controller()->setCorrection(TypicalLEDStrip);
   FastLED.clear(true);
   FastLED.setBrightness(150);
   int gHue = 0, NUM_LEDS = 250, FRAMES_PER_SECOND = 120;
@@ -293,8 +324,39 @@ void fxSinlon() //* Startup effects
     
     EVERY_N_MILLISECONDS( 20 ) { gHue++; } // slowly cycle the "base color" through the rainbow
   }
-  FastLED.addLeds<WS2812B, LED_PIN, GRB>(leds[0], leds.Size()).setCorrection(TypicalLEDStrip); // back to Matrixled
-  FastLED.setBrightness(BRIGHTNESS);
+  leds.Controller()->setCorrection(UncorrectedColor);
+  leds.ReclaimController();                   // back to Matrixled
+  FastLED.setBrightness(255);                 // matrix brightness is in the output LUT
+}
+
+void composeMessage(uint8_t b, const char *msg, uint8_t t)
+{
+  cMsgBank &bank = msgBank[b];
+  // Head holds 0x00 arguments, its length is what sprintf wrote
+  int len = sprintf(bank.Head, "%c%c%c%c%c%c%c%c%c%c%s%02d%c%02d%c%c%c%c%c%c%c%c%c%c%s%02d%c%c%c%c%c%c%c%c%c%c%s%s%c%c%c%c%c%c%c%c%c%s%02d%c%02d%c%c%c%c%s%c%c%c%c%c%c%c%c%c%c%s",
+                                      EFF_FRAME_RATE,0x00,EFF_HSV_AH,0x00,0xff,0xff,0xff,0xff,0xff,
+                                      EFF_SCROLL_LEFT,"     ",h,':',m,EFF_DELAY_FRAMES,0x00,0x2c,EFF_CUSTOM_RC,0x02,
+                                      EFF_RGB,0x00,0xc8,0x64,EFF_SCROLL_LEFT,"      ",t,'^',' ',EFF_DELAY_FRAMES,0x00,0xee,
+                                      EFF_RGB,0xd3,0x54,0x00,EFF_SCROLL_LEFT,"      ",daysOfTheWeek[now.dayOfTheWeek()],' ',EFF_DELAY_FRAMES,0x00,0xee,
+                                      EFF_RGB,0x00,0x80,0x80,EFF_SCROLL_LEFT,"     ",d,'-',mnth,EFF_DELAY_FRAMES,0x00,0xee,
+                                      EFF_SCROLL_LEFT,"     ",
+                                      EFF_HSV_AH,0x00,0xff,0xff,0xff,0xff,0xff,EFF_SCROLL_LEFT,EFF_FRAME_RATE,0x02," ");
+  if (msg != bank.Message)
+    strcpy(bank.Message, msg);
+  bank.Source.Clear();
+  bank.Source.Add((unsigned char *)bank.Head, len);
+  bank.Source.Add((unsigned char *)bank.Message, strlen(bank.Message));
+  bank.Source.Add(szTail, sizeof(szTail) - 1);
+  msgLatest = b;
+}
+
+void queueMessage(const char *msg, uint8_t t)
+{
+  // The bank ScrollingMsg is not reading, a queued one is only read once the other has ended
+  uint8_t b = (ScrollingMsg.Source() == &msgBank[0].Source) ? 1 : 0;
+  composeMessage(b, msg, t);
+  ScrollingMsg.QueueSource(&msgBank[b].Source);  // refused while the welcome message runs, it starts from msgLatest
+  msgStale = false;
 }
 
 void setup()
@@ -306,11 +368,11 @@ void setup()
   //  EEPROM
   EEPROM.begin(512);
   Serial.println("\n\nEEPROM STARTED");
-  curMessage[0] = newMessage[0] = '\0';
-  eepromReadString(0,BUF_SIZE).toCharArray(curMessage,BUF_SIZE);  // Read stored msg from EEPROM address 0
+  msgBank[0].Message[0] = newMessage[0] = '\0';
+  eepromReadString(0,BUF_SIZE).toCharArray(msgBank[0].Message,BUF_SIZE);  // Read stored msg from EEPROM address 0
   newMessageAvailable = false;
   Serial.print("Message: ");
-  Serial.println(curMessage);
+  Serial.println(msgBank[0].Message);
 
   BRIGHTNESS = eepromReadChar(BRT_BEGIN);                          // read Neomatrix brightness value
   if(BRIGHTNESS > 255) { BRIGHTNESS = 255;}
@@ -320,17 +382,24 @@ void setup()
   //  START DISPLAY
   Serial.println("\nNEOMATRIX DIPLAY STARTED");
   FastLED.setMaxPowerInVoltsAndMilliamps(VOLTS, MAX_MA);
-  FastLED.addLeds<WS2812B, LED_PIN, GRB>(leds[0], leds.Size()).setCorrection(TypicalLEDStrip); //TypicalSMD5050
-  FastLED.setBrightness(BRIGHTNESS);
+  leds.SetOutputArray(ledFrame);
+  leds.SetOutputLUT(BRIGHTNESS, TypicalLEDStrip, LED_GAMMA, true, DITHER_MS);  // gamma x correction x brightness in one pass, dithered as FastLED stays at 255
+  lutBrightness = BRIGHTNESS;
+  leds.SetController(addMatrixLeds());        // the only controller, effects borrow it
+  FastLED.setBrightness(255);
   FastLED.clear(true);
 
   ScrollingMsg.SetFont(RobertFontData);
-  ScrollingMsg.Init(&leds, leds.Width(), ScrollingMsg.FontHeight() + 1, 0, 0); //? change to +2 for 5x7 font
-  ScrollingMsg.SetText((unsigned char *)szMesg, sizeof(szMesg) - 1);
+  scene.AddZone(&ScrollingMsg, leds.Width(), ScrollingMsg.FontHeight() + 1, 0, 0); //? change to +2 for 5x7 font
+  ScrollingMsg.SetIncremental(true);              // plain colour parts only draw the column scrolling in
+  ScrollingMsg.SetColrTable(true);                // HSV_AH hues converted once per column, not per pixel
+  ScrollingMsg.SetFrameClock(SCROLL_FPS);         // steps by time, frames the loop misses are skipped, not slowed down
+  ScrollingMsg.SetText(szWelcome, sizeof(szWelcome) - 1);
   ScrollingMsg.SetTextColrOptions(COLR_RGB | COLR_SINGLE, 0x00, 0x00, 0xff);
 
   StaticgMsg.SetFont(RobertFontData);
-  StaticgMsg.Init(&leds, leds.Width(), ScrollingMsg.FontHeight() + 1, 1, 0); // >> 1 pixel //? change to +2 for 5x7 font
+  scene.AddZone(&StaticgMsg, leds.Width(), ScrollingMsg.FontHeight() + 1, 1, 0, SCENE_HOLD); // >> 1 pixel, only drawn when set //? change to +2 for 5x7 font
+  scene.SetVisible(1, false);
   StaticgMsg.SetText((unsigned char *)txtDateA, sizeof(txtDateA) - 1);
   StaticgMsg.SetTextColrOptions(COLR_RGB | COLR_SINGLE, 0x00, 0x00, 0xff);
 
@@ -420,12 +489,20 @@ void setup()
 
   //  DISPLAY WELCOME MESSAGE
   fxSinlon();                                 //* Display special startup effect
-  while(ScrollingMsg.UpdateText() != 1)
-  {
-    FastLED.show();
-    delay(30);
-  }
-  ScrollingMsg.SetText((unsigned char *)szMesg, sizeof(szMesg) - 1);   // reset to start of string
+  Serial.print("LED output: ");
+  Serial.print(FastLED.count());
+  Serial.print(" controller(s), ");
+  Serial.print(cLEDMatrixBase::ShowBytes());
+  Serial.println(" bytes per show");
+  cTextMeasure welcome;                       // loop() scrolls the welcome message, nothing blocks here
+  ScrollingMsg.Measure(&welcome, 0, 1);       // up to EFFECT_CUSTOM_RC "\x01", at SCROLL_FPS
+  Serial.print("Welcome message: ");
+  Serial.print(welcome.Pixels);
+  Serial.print(" pixels, ");
+  Serial.print(welcome.Frames);
+  Serial.print(" frames, ~");
+  Serial.print(welcome.Millis);
+  Serial.println("ms");
 
 
   //Serial.println(TIMER_BASE_CLK);
@@ -443,6 +520,9 @@ void loop()
   static uint32_t timeLast = 0;               // Heartbeat
   static uint8_t t = 0;                       // temperature
   static uint8_t updatetemp = 11;             // so updates temp at startup
+  static uint8_t dateSecs = 0;                // seconds the date is still shown for
+  static uint32_t dateLast = 0;
+  static uint16_t headMinute = 0xffff;        // minute the queued pass was composed with
   
   if (millis() - timeLast >= 1000){
     digitalWrite(LED_BUILTIN, !digitalRead(LED_BUILTIN));
@@ -459,33 +539,34 @@ void loop()
     sprintf(txtDateA, "%c%c%c%c%c%c%c%02d%c%02d", EFF_HSV_AH,0x00,0xff,0xff,0xff,0xff,0xff,h,'|',m);
     sprintf(txtDateB, "%c%c%c%c%c%c%c%02d%c%02d", EFF_HSV_AH,0x00,0xff,0xff,0xff,0xff,0xff,h,':',m);
 
-    sprintf(szMesg, "%c%c%c%c%c%c%c%c%c%c%s%02d%c%02d%c%c%c%c%c%c%c%c%c%c%s%02d%c%c%c%c%c%c%c%c%c%c%s%s%c%c%c%c%c%c%c%c%c%s%02d%c%02d%c%c%c%c%s%c%c%c%c%c%c%c%c%c%c%s%s%s%c%c%c%c",
-                                    EFF_FRAME_RATE,0x00,EFF_HSV_AH,0x00,0xff,0xff,0xff,0xff,0xff,
-                                    EFF_SCROLL_LEFT,"     ",h,':',m,EFF_DELAY_FRAMES,0x00,0x2c,EFF_CUSTOM_RC,0x02,
-                                    EFF_RGB,0x00,0xc8,0x64,EFF_SCROLL_LEFT,"      ",t,'^',' ',EFF_DELAY_FRAMES,0x00,0xee,
-                                    EFF_RGB,0xd3,0x54,0x00,EFF_SCROLL_LEFT,"      ",daysOfTheWeek[now.dayOfTheWeek()],' ',EFF_DELAY_FRAMES,0x00,0xee,
-                                    EFF_RGB,0x00,0x80,0x80,EFF_SCROLL_LEFT,"     ",d,'-',mnth,EFF_DELAY_FRAMES,0x00,0xee,
-                                    EFF_SCROLL_LEFT,"     ",
-                                    EFF_HSV_AH,0x00,0xff,0xff,0xff,0xff,0xff,EFF_SCROLL_LEFT,EFF_FRAME_RATE,0x02," ",curMessage,"     ",EFF_FRAME_RATE,0x00,
-                                    EFF_CUSTOM_RC,0x01);
-                  
-    if(++updatetemp > 10){                    // Update temperature every 10 sec, visual glitch
+    if(++updatetemp > 10){                    // Update temperature every 10 sec
       //! t = RTC.getTemperature();               // +or- from this for calibration
       t=25;
       updatetemp = 0;
+      msgStale = true;
+    }
+    if (m != headMinute){
+      headMinute = m;
+      msgStale = true;
     }
   }
 
   if (newMessageAvailable){
-    strcpy(curMessage, newMessage);           // Copy new message to display
+    queueMessage(newMessage, t);              // shown from the next pass, the one scrolling is left alone
     eepromWriteString(0, newMessage);         // Write String to EEPROM Address 0
     newMessageAvailable = false;
     Serial.println("new message received, updated EEPROM\n");
     delay(100);
-    eepromWriteChar(BRT_BEGIN, BRIGHTNESS);    // White new brightness value
-    FastLED.setBrightness(BRIGHTNESS);
-    Serial.print("NeoMatrix Brightness set to ");
-    Serial.println(BRIGHTNESS);
+    if (BRIGHTNESS != lutBrightness){          // the LUT only depends on the brightness, the rest is fixed
+      eepromWriteChar(BRT_BEGIN, BRIGHTNESS);  // White new brightness value
+      leds.SetOutputLUT(BRIGHTNESS, TypicalLEDStrip, LED_GAMMA, true, DITHER_MS);  // rebuilds the LUT and resends the frame
+      lutBrightness = BRIGHTNESS;
+      Serial.print("NeoMatrix Brightness set to ");
+      Serial.print(BRIGHTNESS);
+      Serial.print(", output pass ");
+      Serial.print(leds.OutputMicros());
+      Serial.println("us/frame");
+    }
   }
 
   if (newTimeAvailable){
@@ -497,32 +578,39 @@ void loop()
     Serial.println("new time received, updated RTC");
   }
 
-  rc = ScrollingMsg.UpdateText();
-  if (rc == -1 || rc == 1)  // -1 means end of char array, 1 means end of msg because custom rc is received
-  {
-    ScrollingMsg.SetText((unsigned char *)szMesg, sizeof(szMesg) - 1);
-  }
-  else if (rc == 2)                               // EFFECT_CUSTOM_RC "\x02"
+  if ((dateSecs > 0) && (millis() - dateLast >= 1000))
   {
-    for (int j = 2; j < 10; j++)                  // want to start on even number to run drawline
+    dateLast = millis();
+    if (--dateSecs == 0)
     {
-      if(j % 2 == 0){ //even
-        StaticgMsg.SetText((unsigned char *)txtDateA, sizeof(txtDateA) - 1);
-        StaticgMsg.UpdateText();
-        leds.DrawLine(0, 0, 0, 7, CRGB(0, 0, 0)); // blank column 1, due to visual glitch text shifting << 1 pixel
-      }
-      else{
-        StaticgMsg.SetText((unsigned char *)txtDateB, sizeof(txtDateB) - 1);
-        StaticgMsg.UpdateText();
-      }
-      FastLED.show();
-      delay(1000);
+      scene.SetVisible(1, false);             // back to the scroller where it stopped
+      scene.SetVisible(0, true);
     }
+    else if (dateSecs % 2 == 0)
+      StaticgMsg.SetText((unsigned char *)txtDateA, sizeof(txtDateA) - 1);
+    else
+      StaticgMsg.SetText((unsigned char *)txtDateB, sizeof(txtDateB) - 1);
   }
-  else
+
+  scene.Update();                             // only the zones whose frame is due, or that were drawn over
+  rc = scene.RC(0);
+  if (rc == -1 || rc == 1)  // -1 means end of char array, 1 means end of the welcome message because custom rc is received
+  {
+    composeMessage(0, msgBank[msgLatest].Message, t);
+    ScrollingMsg.SetSource(&msgBank[0].Source, MSG_LOOKAHEAD);
+  }
+  else if (rc == 2)                               // EFFECT_CUSTOM_RC "\x02"
   {
-    FastLED.show();
+    scene.SetVisible(0, false);                   // date replaces the scroller for 8 seconds, blinking the colon
+    scene.SetVisible(1, true);
+    StaticgMsg.SetText((unsigned char *)txtDateA, sizeof(txtDateA) - 1);
+    dateSecs = 8;
+    dateLast = millis();
   }
+  // A pass has started, or the one queued is out of date, compose the next in the bank not being read
+  if ((ScrollingMsg.Source() != NULL) && ((msgStale) || (!ScrollingMsg.SourceQueued())))
+    queueMessage(msgBank[msgLatest].Message, t);
+  leds.Show();                                // changed frames, unchanged ones only every DITHER_MS for the dither
   delay(10);
   display.clearDisplay();
 
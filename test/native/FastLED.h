@@ -0,0 +1,138 @@
+/*
+  Host stand-in for the parts of FastLED and Arduino that LEDMatrix and LEDText use, for the native test env.
+  Controllers only record their LEDs, show() counts the bytes they would clock out.
+*/
+
+#ifndef FastLED_h
+#define FastLED_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#define PROGMEM
+#define pgm_read_byte(a) (*(const uint8_t *)(a))
+#define pgm_read_word(a) (*(const uint16_t *)(a))
+#define pgm_read_dword(a) (*(const uint32_t *)(a))
+
+inline unsigned long micros()
+{
+  static const auto t0 = std::chrono::steady_clock::now();
+  return ((unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count());
+}
+
+struct cHostSerial
+{
+  void begin(long) {}
+  void println(const char *) {}
+};
+static cHostSerial Serial;
+
+inline uint8_t scale8(uint8_t i, uint8_t Scale) { return (((uint16_t)i * (1 + Scale)) >> 8); }
+inline uint16_t lerp16by16(uint16_t a, uint16_t b, uint16_t Frac) { return (a + (uint16_t)(((int32_t)(b - a) * Frac) >> 16)); }
+
+struct CHSV
+{
+  uint8_t h, s, v;
+  CHSV() {}
+  CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+struct CRGB
+{
+  union
+  {
+    struct { uint8_t r, g, b; };
+    uint8_t raw[3];
+  };
+  CRGB() {}
+  CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+  CRGB(uint32_t Code) : r(Code >> 16), g(Code >> 8), b(Code) {}
+  // Any fixed mapping will do for comparing frames, this is six linear segments
+  CRGB &operator=(const CHSV &Hsv)
+  {
+    uint8_t Seg = Hsv.h / 43, Rise = (Hsv.h - (Seg * 43)) * 6;
+    uint8_t Lo = scale8(Hsv.v, 255 - Hsv.s), Up = scale8(Hsv.v, Rise), Dn = Hsv.v - Up;
+    const uint8_t Rgb[6][3] = { { Hsv.v, Up, Lo }, { Dn, Hsv.v, Lo }, { Lo, Hsv.v, Up }, { Lo, Dn, Hsv.v }, { Up, Lo, Hsv.v }, { Hsv.v, Lo, Dn } };
+    r = Rgb[Seg][0];
+    g = Rgb[Seg][1];
+    b = Rgb[Seg][2];
+    return (*this);
+  }
+  CRGB &nscale8(uint8_t Scale)
+  {
+    r = scale8(r, Scale);
+    g = scale8(g, Scale);
+    b = scale8(b, Scale);
+    return (*this);
+  }
+  uint8_t &operator[](uint8_t i) { return (raw[i]); }
+  const uint8_t &operator[](uint8_t i) const { return (raw[i]); }
+};
+
+inline void fill_solid(struct CRGB *pLeds, int Leds, const struct CRGB &Col)
+{
+  for (int i=0; i<Leds; ++i)
+    pLeds[i] = Col;
+}
+
+enum LEDColorCorrection { TypicalLEDStrip = 0xFFB0F0, UncorrectedColor = 0xFFFFFF };
+enum { WS2812B, WS2811_PORTA };
+enum { RGB, GRB };
+
+class CLEDController
+{
+  struct CRGB *m_Data;
+  int m_nLeds;
+
+public:
+  CLEDController(struct CRGB *pLeds, int Leds) : m_Data(pLeds), m_nLeds(Leds) {}
+  CLEDController &setLeds(struct CRGB *pLeds, int Leds) { m_Data = pLeds; m_nLeds = Leds; return (*this); }
+  CLEDController &setCorrection(uint32_t) { return (*this); }
+  struct CRGB *leds() { return (m_Data); }
+  int size() { return (m_nLeds); }
+};
+
+class CFastLED
+{
+  CLEDController *m_Controllers[8];
+  int m_Count;
+  uint8_t m_Brightness;
+
+public:
+  uint32_t m_Shows, m_Bytes;     // show() calls and bytes they clocked out, 3 per LED of every controller
+
+  CFastLED() : m_Count(0), m_Brightness(255), m_Shows(0), m_Bytes(0) {}
+  template <int CHIP, int PIN, int ORDER> CLEDController &addLeds(struct CRGB *pLeds, int Leds)
+  {
+    m_Controllers[m_Count] = new CLEDController(pLeds, Leds);
+    return (*m_Controllers[m_Count++]);
+  }
+  void show()
+  {
+    m_Shows++;
+    for (int i=0; i<m_Count; ++i)
+      m_Bytes += m_Controllers[i]->size() * 3;
+  }
+  void clear(bool Write = false)
+  {
+    for (int i=0; i<m_Count; ++i)
+      fill_solid(m_Controllers[i]->leds(), m_Controllers[i]->size(), CRGB(0, 0, 0));
+    if (Write)
+      show();
+  }
+  void setBrightness(uint8_t Brightness) { m_Brightness = Brightness; }
+  uint8_t getBrightness() { return (m_Brightness); }
+  int count() { return (m_Count); }
+  CLEDController &operator[](int i) { return (*m_Controllers[i]); }
+};
+
+extern CFastLED FastLED;
+
+#endif
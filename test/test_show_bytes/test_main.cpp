@@ -0,0 +1,86 @@
+/*
+  Bytes clocked out per show() by the matrix controller, native env (pio test -e native).
+  Same setup as main.cpp: one 32x8 panel, one controller, fxSinlon() borrowing it for its own buffer.
+*/
+
+#include <FastLED.h>
+#include <LEDMatrix.h>
+#include <unity.h>
+
+#define MATRIX_WIDTH  -32
+#define MATRIX_HEIGHT -8
+#define MATRIX_TYPE VERTICAL_MATRIX
+#define LED_SEGMENTS 1
+
+CFastLED FastLED;
+
+cLEDMatrix<MATRIX_WIDTH, MATRIX_HEIGHT, MATRIX_TYPE> leds;
+CRGB fleds[256];
+CRGB ledFrame[256];
+
+// Bytes sent by the show() calls in Shows()
+static uint32_t ShowsBytes(void (*Shows)())
+{
+  uint32_t Bytes = FastLED.m_Bytes;
+
+  Shows();
+  return (FastLED.m_Bytes - Bytes);
+}
+
+static void EffectShow() { FastLED.show(); }
+static void MatrixShow() { leds.Show(); }
+
+void setUp() {}
+void tearDown() {}
+
+void test_matrix_controller()
+{
+  leds.SetOutputArray(ledFrame);
+  leds.SetController(FastLED.addLeds<WS2812B, 7, GRB>(leds.OutputArray(), leds.Size()).setCorrection(UncorrectedColor));
+  TEST_ASSERT_EQUAL(1, FastLED.count());
+  TEST_ASSERT_EQUAL(768, cLEDMatrixBase::ShowBytes());
+  leds.MarkDirty();
+  TEST_ASSERT_EQUAL(768, ShowsBytes(MatrixShow));
+}
+
+// fxSinlon(): lend the controller, show the effect buffer, reclaim it for the matrix
+void test_sinlon_lend_reclaim()
+{
+  leds.LendController(fleds, leds.Size() / LED_SEGMENTS);
+  TEST_ASSERT_EQUAL(1, FastLED.count());
+  TEST_ASSERT_EQUAL_PTR(fleds, leds.Controller()->leds());
+  TEST_ASSERT_EQUAL(768, cLEDMatrixBase::ShowBytes());
+  for (int i=0; i<10; ++i)
+  {
+    fleds[i] = CRGB(0, 0, 192);
+    TEST_ASSERT_EQUAL(768, ShowsBytes(EffectShow));
+  }
+  leds.ReclaimController();
+  TEST_ASSERT_EQUAL(1, FastLED.count());
+  TEST_ASSERT_EQUAL_PTR(leds.OutputArray(), leds.Controller()->leds());
+  TEST_ASSERT_EQUAL(768, cLEDMatrixBase::ShowBytes());
+  // Reclaiming marks the matrix dirty, so the next Show() resends it
+  TEST_ASSERT_EQUAL(768, ShowsBytes(MatrixShow));
+  TEST_ASSERT_EQUAL(0, ShowsBytes(MatrixShow));
+}
+
+// Dither resends unchanged frames, but no more often than its interval
+void test_dither_interval()
+{
+  leds.SetOutputLUT(30, TypicalLEDStrip, 2.2, true, 1000);
+  TEST_ASSERT_EQUAL(768, ShowsBytes(MatrixShow));
+  TEST_ASSERT_EQUAL(0, ShowsBytes(MatrixShow));
+  leds.SetOutputLUT(30, TypicalLEDStrip, 2.2, true);
+  TEST_ASSERT_EQUAL(768, ShowsBytes(MatrixShow));
+  TEST_ASSERT_EQUAL(768, ShowsBytes(MatrixShow));
+  leds.ClearOutputLUT();
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_matrix_controller);
+  RUN_TEST(test_sinlon_lend_reclaim);
+  RUN_TEST(test_dither_interval);
+  return (UNITY_END());
+}
@@ -0,0 +1,77 @@
+/*
+  A text streamed by SetSource() draws the same frames as SetText(), native env (pio test -e native).
+  Lookaheads shorter than the text of one frame have to be grown by the renderer, not cut.
+*/
+
+#include <FastLED.h>
+#include <LEDMatrix.h>
+#include <LEDText.h>
+#include <FontMatrise.h>
+#include <unity.h>
+
+#define MATRIX_WIDTH  40
+#define MATRIX_HEIGHT 8
+#define MATRIX_TYPE HORIZONTAL_MATRIX
+
+CFastLED FastLED;
+
+const char Head[] = { EFFECT_SCROLL_LEFT EFFECT_HSV_AH "\x01\xff\xff\x40\xff\xff" "  12:30 " EFFECT_FRAME_RATE "\x01" };
+const char Message[] = { "ABC 0.5-9 " EFFECT_DELAY_FRAMES "\x00\x10" " THE " EFFECT_RGB_CV "\x10\x20\x30\x40\x50\x60" "QUICK " };
+const char Tail[] = { EFFECT_CUSTOM_RC "\x05" EFFECT_SCROLL_UP " 7.1 " EFFECT_SCROLL_RIGHT " CAB " EFFECT_CUSTOM_RC "\x06" };
+
+// Frames until the text ends, -1 from the frame SetText() and SetSource() first differ
+static int CompareFrames(uint16_t Lookahead)
+{
+  cLEDMatrix<MATRIX_WIDTH, MATRIX_HEIGHT, MATRIX_TYPE> MatrixA, MatrixB;
+  cLEDText TextA, TextB;
+  cTextSegments Source;
+  unsigned char Whole[sizeof(Head) + sizeof(Message) + sizeof(Tail)];
+  uint16_t Len = 0;
+  int Frame, rcA, rcB;
+
+  memcpy(&Whole[Len], Head, sizeof(Head) - 1);
+  Len += sizeof(Head) - 1;
+  memcpy(&Whole[Len], Message, sizeof(Message) - 1);
+  Len += sizeof(Message) - 1;
+  memcpy(&Whole[Len], Tail, sizeof(Tail) - 1);
+  Len += sizeof(Tail) - 1;
+  Source.Add((const unsigned char *)Head, sizeof(Head) - 1);
+  Source.Add((const unsigned char *)Message, sizeof(Message) - 1);
+  Source.Add((const unsigned char *)Tail, sizeof(Tail) - 1);
+  TextA.SetFont(MatriseFontData);
+  TextB.SetFont(MatriseFontData);
+  TextA.Init(&MatrixA, MatrixA.Width(), MatrixA.Height(), 0, 0);
+  TextB.Init(&MatrixB, MatrixB.Width(), MatrixB.Height(), 0, 0);
+  TextA.SetText(Whole, Len);
+  TextB.SetSource(&Source, Lookahead);
+  for (Frame=0; Frame<5000; ++Frame)
+  {
+    rcA = TextA.UpdateText();
+    rcB = TextB.UpdateText();
+    if ( (rcA != rcB) || (memcmp(MatrixA[0], MatrixB[0], MatrixA.Size() * sizeof(CRGB)) != 0) )
+      return (-1);
+    if (rcA == -1)
+      return (Frame);
+  }
+  return (-1);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_lookahead_below_one_frame()
+{
+  int Frames = CompareFrames(64);
+
+  TEST_ASSERT_TRUE(Frames > 0);
+  TEST_ASSERT_EQUAL(Frames, CompareFrames(4));
+  TEST_ASSERT_EQUAL(Frames, CompareFrames(8));
+  TEST_ASSERT_EQUAL(Frames, CompareFrames(12));
+}
+
+int main()
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_lookahead_below_one_frame);
+  return (UNITY_END());
+}